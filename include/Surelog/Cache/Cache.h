@@ -59,6 +59,10 @@ class Cache {
 
   std::string_view getExecutableTimeStamp() const;
 
+  // Opens the cache file for reading, hinting the OS to read it ahead as the
+  // whole file is decoded sequentially. Returns a negative value on failure.
+  static int32_t openForRead(PathId cacheFileId);
+
   bool checkIfCacheIsValid(const Header::Reader& header,
                            std::string_view schemaVersion, PathId cacheFileId,
                            PathId sourceFileId) const;
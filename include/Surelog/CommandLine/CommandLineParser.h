@@ -152,6 +152,7 @@ class CommandLineParser final {
   bool parse() const { return m_parse; }
   bool parseOnly() const { return m_parseOnly; }
   bool lowMem() const { return m_lowMem; }
+  bool streaming() const { return m_streaming; }
   bool compile() const { return m_compile; }
   bool elaborate() const { return m_elaborate; }
   bool writeUhdm() const { return m_writeUhdm; }
@@ -161,6 +162,7 @@ class CommandLineParser final {
   void setParse(bool val) { m_parse = val; }
   void setParseOnly(bool val) { m_parseOnly = val; }
   void setLowMem(bool val) { m_lowMem = val; }
+  void setStreaming(bool val) { m_streaming = val; }
   void setCompile(bool val) { m_compile = val; }
   void setElaborate(bool val) { m_elaborate = val; }
   void setSepComp(bool val) {
@@ -365,6 +367,7 @@ class CommandLineParser final {
   bool m_replay;
   bool m_uhdmStats;
   bool m_lowMem;
+  bool m_streaming;
   bool m_writeUhdm;
   bool m_nonSynthesizable;
   bool m_nonSynthesizableWithFormal;
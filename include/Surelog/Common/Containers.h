@@ -2,10 +2,13 @@
 #define SURELOG_CONTAINERS_H
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace SURELOG {
@@ -18,6 +21,135 @@ struct StringViewCompare {
   }
 };
 
+// Name ordered map with a hash index on the names, built once the map is
+// large enough for the index to beat the tree lookup. Iterates in name order
+// like the std::map it replaces, of which it offers the subset in use.
+template <typename T>
+class NameMap final {
+  using Storage = std::map<std::string, T, StringViewCompare>;
+
+ public:
+  using key_type = typename Storage::key_type;
+  using mapped_type = typename Storage::mapped_type;
+  using value_type = typename Storage::value_type;
+  using size_type = typename Storage::size_type;
+  using iterator = typename Storage::iterator;
+  using const_iterator = typename Storage::const_iterator;
+  using reverse_iterator = typename Storage::reverse_iterator;
+  using const_reverse_iterator = typename Storage::const_reverse_iterator;
+
+  NameMap() = default;
+  NameMap(const NameMap& other) : m_storage(other.m_storage) { reindex(); }
+  NameMap(NameMap&& other) noexcept
+      : m_storage(std::move(other.m_storage)),
+        m_index(std::move(other.m_index)) {
+    other.clear();
+  }
+  NameMap& operator=(const NameMap& other) {
+    if (this != &other) {
+      m_storage = other.m_storage;
+      reindex();
+    }
+    return *this;
+  }
+  NameMap& operator=(NameMap&& other) noexcept {
+    if (this != &other) {
+      m_storage = std::move(other.m_storage);
+      m_index = std::move(other.m_index);
+      other.clear();
+    }
+    return *this;
+  }
+
+  iterator begin() { return m_storage.begin(); }
+  iterator end() { return m_storage.end(); }
+  const_iterator begin() const { return m_storage.begin(); }
+  const_iterator end() const { return m_storage.end(); }
+  const_iterator cbegin() const { return m_storage.cbegin(); }
+  const_iterator cend() const { return m_storage.cend(); }
+  reverse_iterator rbegin() { return m_storage.rbegin(); }
+  reverse_iterator rend() { return m_storage.rend(); }
+  const_reverse_iterator rbegin() const { return m_storage.rbegin(); }
+  const_reverse_iterator rend() const { return m_storage.rend(); }
+
+  bool empty() const { return m_storage.empty(); }
+  size_type size() const { return m_storage.size(); }
+
+  iterator find(std::string_view name) {
+    if (m_index.empty()) return m_storage.find(name);
+    auto itr = m_index.find(name);
+    return (itr == m_index.end()) ? m_storage.end() : itr->second;
+  }
+  const_iterator find(std::string_view name) const {
+    if (m_index.empty()) return m_storage.find(name);
+    auto itr = m_index.find(name);
+    return (itr == m_index.end()) ? m_storage.end() : itr->second;
+  }
+  size_type count(std::string_view name) const {
+    return (find(name) == end()) ? 0 : 1;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    std::pair<iterator, bool> result =
+        m_storage.emplace(std::forward<Args>(args)...);
+    if (result.second) index(result.first);
+    return result;
+  }
+  template <typename P>
+  std::pair<iterator, bool> insert(P&& value) {
+    return emplace(std::forward<P>(value));
+  }
+  mapped_type& operator[](std::string_view name) {
+    iterator itr = find(name);
+    if (itr != end()) return itr->second;
+    return emplace(std::string(name), mapped_type()).first->second;
+  }
+
+  iterator erase(iterator pos) {
+    if (!m_index.empty()) m_index.erase(pos->first);
+    return m_storage.erase(pos);
+  }
+  iterator erase(const_iterator pos) {
+    if (!m_index.empty()) m_index.erase(pos->first);
+    return m_storage.erase(pos);
+  }
+  size_type erase(std::string_view name) {
+    iterator itr = find(name);
+    if (itr == end()) return 0;
+    erase(itr);
+    return 1;
+  }
+  void clear() {
+    m_index.clear();
+    m_storage.clear();
+  }
+
+ private:
+  static constexpr size_t kIndexThreshold = 16;
+
+  void index(iterator itr) {
+    if (!m_index.empty()) {
+      m_index.emplace(itr->first, itr);
+    } else if (m_storage.size() >= kIndexThreshold) {
+      reindex();
+    }
+  }
+  // The keys of the index are views on the keys of the map nodes, which
+  // never move.
+  void reindex() {
+    m_index.clear();
+    if (m_storage.size() < kIndexThreshold) return;
+    m_index.reserve(m_storage.size());
+    for (iterator itr = m_storage.begin(); itr != m_storage.end(); ++itr) {
+      m_index.emplace(itr->first, itr);
+    }
+  }
+
+  Storage m_storage;
+  std::unordered_map<std::string_view, iterator> m_index;
+};
+
 class ClassDefinition;
 class ModuleDefinition;
 class Package;
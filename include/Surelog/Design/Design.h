@@ -29,10 +29,12 @@
 #include <Surelog/Common/NodeId.h>
 #include <Surelog/Common/PathId.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -66,6 +68,7 @@ class Design final {
   friend class AnalyzeFile;
   friend class Builtin;
   friend class CompileDesign;
+  friend class CompileSourceFile;
   friend class Compiler;
   friend class DesignElaboration;
   friend class ParseCache;
@@ -174,6 +177,9 @@ class Design final {
   // Thread-safe
   void addPPFileContent(PathId fileId, FileContent* content);
 
+  // Thread-safe. Unregisters and deletes the given preprocessor contents.
+  void deletePPFileContents(const std::set<FileContent*>& contents);
+
   void addOrderedPackage(std::string_view packageName) {
     m_orderedPackageNames.emplace_back(packageName);
   }
@@ -202,9 +208,15 @@ class Design final {
 
   void orderPackages();
 
+  // Levels of the ordered packages in their import graph: 0 for a package
+  // importing no other package, otherwise 1 + the highest level of the
+  // packages it imports. Packages of a same level do not depend on each other.
+  // The null slots of unresolved names get a level 0.
+  std::vector<uint32_t> computePackageLevels() const;
+
  private:
   ModuleInstance* findInstance_(const std::vector<std::string>& path,
-                                ModuleInstance* scope) const;
+                                size_t index, ModuleInstance* scope) const;
   void addDefParam_(std::vector<std::string>& path, const FileContent* fC,
                     NodeId nodeId, Value* value, DefParam* parent);
   DefParam* getDefParam_(std::vector<std::string>& path,
@@ -89,20 +89,18 @@ class DesignComponent : public ValuedComponentI, public PortNetHolder {
   virtual std::string_view getName() const = 0;
   void append(DesignComponent*);
 
-  using DataTypeMap = std::map<std::string, DataType*, StringViewCompare>;
-  using TypeDefMap = std::map<std::string, TypeDef*, StringViewCompare>;
+  using DataTypeMap = NameMap<DataType*>;
+  using TypeDefMap = NameMap<TypeDef*>;
   using DataTypeVec = std::vector<DataType*>;
   using TypeDefVec = std::vector<TypeDef*>;
-  using FunctionMap = std::map<std::string, Function*, StringViewCompare>;
-  using TaskMap = std::map<std::string, Task*, StringViewCompare>;
-  using VariableMap = std::map<std::string, Variable*, StringViewCompare>;
-  using ParameterMap = std::map<std::string, Parameter*, StringViewCompare>;
+  using FunctionMap = NameMap<Function*>;
+  using TaskMap = NameMap<Task*>;
+  using VariableMap = NameMap<Variable*>;
+  using ParameterMap = NameMap<Parameter*>;
   using ParameterVec = std::vector<Parameter*>;
   using ParamAssignVec = std::vector<ParamAssign*>;
-  using LetStmtMap = std::map<std::string, LetStmt*, StringViewCompare>;
-  using NamedObjectMap =
-      std::map<std::string, std::pair<FileCNodeId, DesignComponent*>,
-               StringViewCompare>;
+  using LetStmtMap = NameMap<LetStmt*>;
+  using NamedObjectMap = NameMap<std::pair<FileCNodeId, DesignComponent*>>;
   using FuncNameTypespecVec =
       std::vector<std::pair<std::string, UHDM::typespec*>>;
 
@@ -76,6 +76,10 @@ class FileContent final : public DesignComponent {
       NodeId parent, const VObjectTypeUnorderedSet& types,
       VObjectType& actualType) const;  // Get first parent item of type
 
+  NodeId sl_parent(
+      NodeId parent, const VObjectTypeBitSet& types,
+      VObjectType& actualType) const;  // Get first parent item of type
+
   std::vector<NodeId> sl_get_all(
       NodeId parent, VObjectType type) const;  // get all child items of type
 
@@ -83,6 +87,10 @@ class FileContent final : public DesignComponent {
                                  const VObjectTypeUnorderedSet& types)
       const;  // get all child items of types
 
+  std::vector<NodeId> sl_get_all(NodeId parent,
+                                 const VObjectTypeBitSet& types)
+      const;  // get all child items of types
+
   NodeId sl_collect(
       NodeId parent,
       VObjectType type) const;  // Recursively search for first item of type
@@ -99,12 +107,23 @@ class FileContent final : public DesignComponent {
       NodeId parent, const VObjectTypeUnorderedSet& types,
       bool first = false) const;  // Recursively search for all items of types
 
+  std::vector<NodeId> sl_collect_all(
+      NodeId parent, const VObjectTypeBitSet& types,
+      bool first = false) const;  // Recursively search for all items of types
+
   std::vector<NodeId> sl_collect_all(NodeId parent,
                                      const VObjectTypeUnorderedSet& types,
                                      const VObjectTypeUnorderedSet& stopPoints,
                                      bool first = false) const;
   // Recursively search for all items of types
   // and stops at types stopPoints
+
+  // The VObjectTypeBitSet flavors test the types with a single bit test,
+  // prefer them with static constexpr sets in the hot paths
+  std::vector<NodeId> sl_collect_all(NodeId parent,
+                                     const VObjectTypeBitSet& types,
+                                     const VObjectTypeBitSet& stopPoints,
+                                     bool first = false) const;
   uint32_t getSize() const final {
     return static_cast<uint32_t>(m_objects.size());
   }
@@ -228,6 +247,17 @@ class FileContent final : public DesignComponent {
                            UHDM::any* instance) const;
 
  protected:
+  // Shared by the VObjectTypeUnorderedSet and VObjectTypeBitSet flavors
+  template <typename TypeSet>
+  NodeId sl_parent_(NodeId parent, const TypeSet& types,
+                    VObjectType& actualType) const;
+  template <typename TypeSet>
+  std::vector<NodeId> sl_get_all_(NodeId parent, const TypeSet& types) const;
+  template <typename TypeSet>
+  std::vector<NodeId> sl_collect_all_(NodeId parent, const TypeSet& types,
+                                      const TypeSet* stopPoints,
+                                      bool first) const;
+
   std::vector<DesignElement*> m_elements;
   std::map<std::string, DesignElement*, StringViewCompare> m_elementMap;
   std::vector<VObject> m_objects;
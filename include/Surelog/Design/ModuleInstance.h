@@ -35,11 +35,14 @@
 #include <uhdm/expr.h>
 #include <uhdm/module_array.h>
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace SURELOG {
@@ -97,7 +100,11 @@ class ModuleInstance final : public ValuedComponentI {
   SymbolId getInstanceId(SymbolTable* symbols) const;
   SymbolId getModuleNameId(SymbolTable* symbols) const;
   std::string getInstanceName() const;
+  std::string_view getInstanceNameView() const;
   std::string getFullPathName() const;
+  // Built from the path of the parent, rebuilt when the parent or its path
+  // changed since. The view is valid until the next call.
+  std::string_view getFullPathNameView() const;
   std::string_view getModuleName() const;
   uint32_t getDepth() const;
 
@@ -124,6 +131,9 @@ class ModuleInstance final : public ValuedComponentI {
 
   ModuleInstance* getChildByName(std::string_view name);
 
+  // Children called "name", in instantiation order.
+  const std::vector<ModuleInstance*>& getChildrenByName(std::string_view name);
+
  private:
   DesignComponent* m_definition;
   std::vector<ModuleInstance*> m_allSubInstances;
@@ -138,6 +148,24 @@ class ModuleInstance final : public ValuedComponentI {
   bool m_elaborated = false;
   std::set<std::string, StringViewCompare> m_overridenParams;
   ModuleArrayModuleInstancesMap m_moduleArrayModuleInstancesMap;
+
+  // Each build of a full path gets a unique stamp (0: never built), the cache
+  // of an instance holds while its parent and the parent stamp are unchanged.
+  // Costs 48 bytes (no padding in this order) plus the path text per
+  // instance. The paths are unique, interning them in the symbol table would
+  // not share any text and would keep the stale paths of re-parented
+  // instances for the lifetime of the table.
+  mutable std::string m_fullPathName;
+  mutable const ModuleInstance* m_fullPathParent = nullptr;
+  mutable uint32_t m_fullPathStamp = 0;
+  mutable uint32_t m_fullPathParentStamp = 0;
+  static std::atomic<uint32_t> s_fullPathStamps;
+
+  // Lazily extended index of m_allSubInstances by instance name, the
+  // elaboration appends children directly to the vector.
+  std::unordered_map<std::string_view, std::vector<ModuleInstance*>>
+      m_childrenByName;
+  size_t m_indexedChildCount = 0;
 };
 
 class ModuleInstanceFactory {
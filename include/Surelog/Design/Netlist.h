@@ -28,9 +28,12 @@
 // UHDM
 #include <uhdm/uhdm_forward_decl.h>
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -105,6 +108,10 @@ class Netlist {
     m_param_assigns = assigns;
   }
 
+  // Positions in param_assigns() of the assignments to "name", in order.
+  // Indexes the assignments appended since the previous call.
+  const std::vector<uint32_t>& getParamAssignPositions(std::string_view name);
+
   std::vector<UHDM::port*>& actualPorts() { return m_actualPorts; }
   SymbolTable& getSymbolTable() { return m_symbolTable; }
   ModPortMap& getModPortMap() { return m_modPortMap; }
@@ -135,6 +142,10 @@ class Netlist {
   SymbolTable m_symbolTable;
   ModPortMap m_modPortMap;
   InstanceMap m_instanceMap;
+  const std::vector<UHDM::param_assign*>* m_indexedParamAssigns = nullptr;
+  size_t m_indexedParamAssignCount = 0;
+  std::unordered_map<std::string_view, std::vector<uint32_t>>
+      m_paramAssignPositions;
 };
 
 };  // namespace SURELOG
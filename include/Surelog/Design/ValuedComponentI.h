@@ -34,7 +34,6 @@
 // UHDM
 #include <uhdm/uhdm_forward_decl.h>
 
-#include <map>
 #include <string>
 #include <string_view>
 
@@ -46,9 +45,8 @@ class Value;
 class ValuedComponentI : public RTTI {
   SURELOG_IMPLEMENT_RTTI(ValuedComponentI, RTTI)
  public:
-  using ParamMap =
-      std::map<std::string, std::pair<Value*, int32_t>, StringViewCompare>;
-  using ComplexValueMap = std::map<std::string, UHDM::expr*, StringViewCompare>;
+  using ParamMap = NameMap<std::pair<Value*, int32_t>>;
+  using ComplexValueMap = NameMap<UHDM::expr*>;
 
   ValuedComponentI(const ValuedComponentI* parentScope,
                    ValuedComponentI* definition)
@@ -30,6 +30,9 @@
 
 #include <cstdint>
 #include <map>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 // UHDM
@@ -60,6 +63,20 @@ class CompileDesign {
   void purgeParsers();
   vpiHandle writeUHDM(PathId fileId);
 
+  // Saves the UHDM database to "fileId".
+  void saveUhdm(PathId fileId);
+  // Same on a background thread, for work that can overlap with the save.
+  // Neither the model nor the file can be used again before waitForUhdmSave()
+  // returns.
+  void saveUhdmAsync(PathId fileId);
+  void waitForUhdmSave();
+  // Shape of the package dependency graph, for -profile.
+  const std::string& getCompileProfile() const { return m_compileProfile; }
+  // Time of the UHDM passes and size, time and throughput of the last save,
+  // for -profile.
+  const std::string& getUhdmProfile() const { return m_uhdmProfile; }
+  void addUhdmProfile(std::string_view info) { m_uhdmProfile.append(info); }
+
   Compiler* getCompiler() const { return m_compiler; }
   virtual UHDM::Serializer& getSerializer() { return m_serializer; }
   void lockSerializer() { m_serializerMutex.lock(); }
@@ -77,14 +94,19 @@ class CompileDesign {
                        Design* design, bool finalCollection);
   bool compilation_();
   bool elaboration_();
+  void profileUhdmSave_();
 
   Compiler* const m_compiler;
-  std::vector<SymbolTable*> m_symbolTables;
   std::vector<ErrorContainer*> m_errorContainers;
   UHDM::VectorOfinclude_file_info* m_fileInfo = nullptr;
   std::mutex m_serializerMutex;
   UHDM::Serializer m_serializer;
   std::map<const UHDM::typespec*, const UHDM::typespec*> m_typespecSwapMap;
+  std::thread* m_uhdmSaveThread = nullptr;
+  PathId m_uhdmSaveFileId;
+  double m_uhdmSaveSeconds = 0;
+  std::string m_compileProfile;
+  std::string m_uhdmProfile;
 };
 
 }  // namespace SURELOG
@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <map>
 #include <set>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -49,15 +50,6 @@ class UhdmChecker final {
   bool check(PathId uhdmFileId);
 
  private:
-  bool registerFile(const FileContent* fC,
-                    std::set<std::string_view>& moduleNames);
-  bool reportHtml(PathId uhdmFileId, float overallCoverage);
-  float reportCoverage(PathId uhdmFileId);
-  void annotate();
-  void mergeColumnCoverage();
-
-  CompileDesign* const m_compileDesign;
-  Design* const m_design;
   using LineNb = uint32_t;
   enum Status { EXIST, COVERED, UNSUPPORTED };
   class ColRange {
@@ -68,6 +60,30 @@ class UhdmChecker final {
   };
   using Ranges = std::vector<ColRange>;
   using RangesMap = std::map<LineNb, Ranges>;
+
+  // Part of the HTML report of a single file, merged in file order into the
+  // summary page.
+  struct FileReport final {
+    bool m_written = false;
+    int32_t m_coverage = 0;
+    std::string m_status;     // Line of the ordered coverage list
+    std::string m_uncovered;  // Section of the "All Uncovered" list
+    std::vector<int32_t> m_emptyLines;
+  };
+
+  bool registerFile(const FileContent* fC,
+                    const std::set<std::string_view>& moduleNames,
+                    RangesMap& uhdmCover) const;
+  bool reportHtml(PathId uhdmFileId, float overallCoverage);
+  void reportFileHtml(const FileContent* fC, const RangesMap& uhdmCover,
+                      PathId chkFileId, FileReport& result) const;
+  float reportCoverage(PathId uhdmFileId);
+  void annotate();
+  static void mergeColumnCoverage(RangesMap& uhdmCover);
+  uint32_t getThreadCount() const;
+
+  CompileDesign* const m_compileDesign;
+  Design* const m_design;
   using FileNodeCoverMap = std::map<const FileContent*, RangesMap>;
   FileNodeCoverMap fileNodeCoverMap;
   std::map<PathId, const FileContent*, PathIdLessThanComparer> fileMap;
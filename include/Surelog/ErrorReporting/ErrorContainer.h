@@ -26,19 +26,19 @@
 #pragma once
 
 #include <Surelog/ErrorReporting/Error.h>
+#include <Surelog/ErrorReporting/LogListener.h>
 
 #include <cstdint>
-#include <set>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 namespace SURELOG {
 
 class CommandLineParser;
-class LogListener;
 class SymbolTable;
 
 class ErrorContainer final {
@@ -81,6 +81,9 @@ class ErrorContainer final {
   bool printMessage(Error& error, bool muteStdout = false);
   bool printStats(Stats stats, bool muteStdout = false);
   bool printToLogFile(std::string_view report);
+  // Writes the batched log messages, before the symbol table and the file
+  // system the log file id refers to are torn down.
+  bool flushLogFile();
   bool hasFatalErrors() const;
   Stats getErrorStats() const;
   void appendErrors(ErrorContainer&);
@@ -90,10 +93,20 @@ class ErrorContainer final {
   void setPythonInterp(void* interpState) { m_interpState = interpState; }
 
  private:
+  // Identifies the text of a message without formatting it, duplicates are
+  // detected on that key.
+  using ErrorKey = std::vector<uint32_t>;
+  struct ErrorKeyHash final {
+    size_t operator()(const ErrorKey& key) const;
+  };
+
+  bool isFiltered_(const Error& error) const;
+  ErrorKey createErrorKey_(const Error& error) const;
   std::pair<std::string, bool> createReport_() const;
   std::pair<std::string, bool> createReport_(const Error& error) const;
+  bool checkLogResult_(LogListener::LogResult result);
   std::vector<Error> m_errors;
-  std::set<std::string> m_errorSet;
+  std::unordered_set<ErrorKey, ErrorKeyHash> m_errorSet;
 
   CommandLineParser* m_clp;
   bool m_reportedFatalErrorLogFile;
@@ -39,9 +39,13 @@ namespace SURELOG {
 // A thread-safe log listener that flushes it contents to a named file on disk.
 // Supports caching a fixed number of messages if the messages arrives before
 // the listener is initialized.
+// Once initialized, messages are batched in memory and appended to the file
+// when the batch is full and on flush(). The destructor does not write: the
+// owner flushes while the file system can still resolve the log file.
 class LogListener {
  private:
   static constexpr uint32_t DEFAULT_MAX_QUEUED_MESSAGE_COUNT = 100;
+  static constexpr uint32_t DEFAULT_MAX_BATCH_SIZE = 64 * 1024;
 
  public:
   enum class LogResult {
@@ -67,6 +71,11 @@ class LogListener {
   virtual void setMaxQueuedMessageCount(int32_t count);
   int32_t getMaxQueuedMessageCount() const;
 
+  // Size in bytes above which the batched messages are written, 0 writes
+  // every message as it is logged.
+  void setMaxBatchSize(uint32_t size);
+  uint32_t getMaxBatchSize() const;
+
   PathId getLogFileId() const;
   int32_t getQueuedMessageCount() const;
 
@@ -77,6 +86,7 @@ class LogListener {
   // NOTE: Internal protected/private methods aren't thread-safe.
   void enqueue(std::string_view message);
   void flush(std::ostream& strm);
+  LogResult write();
 
  protected:
   PathId fileId;
@@ -84,6 +94,8 @@ class LogListener {
   std::deque<std::string> queued;
   int32_t droppedCount = 0;
   uint32_t maxQueuedMessageCount = DEFAULT_MAX_QUEUED_MESSAGE_COUNT;
+  std::string batch;
+  uint32_t maxBatchSize = DEFAULT_MAX_BATCH_SIZE;
 
  public:
   LogListener(const LogListener&) = delete;
@@ -33,6 +33,7 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <tuple>
 
 namespace SURELOG {
 
@@ -66,7 +67,24 @@ class Waiver final {
     return m_waivers;
   }
 
+  // True if a waiver exists for that message id, cheap enough to guard the
+  // computation of the arguments of isWaived().
+  static bool hasWaivers(ErrorDefinition::ErrorType type) {
+    return m_waivers.find(type) != m_waivers.end();
+  }
+
+  // True if a waiver matches the message. An empty file name, a 0 line or an
+  // empty object name in a waiver matches any value.
+  static bool isWaived(ErrorDefinition::ErrorType type,
+                       std::string_view fileName, uint32_t line,
+                       std::string_view objectName);
+
  private:
+  // (message id, file name, line, object name), "" and 0 for the wildcards.
+  using WaiverKey =
+      std::tuple<ErrorDefinition::ErrorType, std::string, uint32_t, std::string>;
+
+  static std::set<WaiverKey, std::less<>> m_waiverIndex;
   static std::set<std::string, std::less<>> m_macroArgCheck;
   static std::multimap<ErrorDefinition::ErrorType, WaiverData> m_waivers;
 };
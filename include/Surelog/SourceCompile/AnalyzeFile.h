@@ -91,7 +91,9 @@ class AnalyzeFile final {
   std::vector<uint32_t> m_lineOffsets;
   int32_t m_nbChunks;
   std::stack<IncludeFileInfo> m_includeFileInfo;
-  std::string m_text;  // unit test
+  // Preprocessed text when available in memory, read from m_ppFileId
+  // otherwise. Only used during analyze().
+  std::string_view m_text;
 };
 
 };  // namespace SURELOG
@@ -25,6 +25,8 @@
 #define SURELOG_ANTLRPARSERHANDLER_H
 #pragma once
 
+#include <cstdint>
+
 namespace antlr4 {
 class ANTLRInputStream;
 class CommonTokenStream;
@@ -44,6 +46,10 @@ class AntlrParserHandler {
  public:
   AntlrParserHandler() = default;
   ~AntlrParserHandler();
+
+  // Approximate number of bytes held by the input and token streams.
+  uint64_t getMemoryUsage() const;
+
   bool m_clearAntlrCache = false;
   antlr4::ANTLRInputStream* m_inputStream = nullptr;
   SV3_1aLexer* m_lexer = nullptr;
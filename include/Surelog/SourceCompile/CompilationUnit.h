@@ -32,6 +32,10 @@
 #include <Surelog/SourceCompile/VObjectTypes.h>
 
 #include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -45,6 +49,19 @@ class CompilationUnit {
   CompilationUnit(const CompilationUnit& orig) = delete;
   virtual ~CompilationUnit() = default;
 
+  // Speculative unit layered over the shared unit "base", used to preprocess
+  // a file concurrently with the files preceding it. Lookups fall through to
+  // "base", which is not modified until the speculation is committed.
+  explicit CompilationUnit(CompilationUnit* base);
+  bool isSpeculative() const { return m_base != nullptr; }
+  CompilationUnit* getBase() const { return m_base; }
+  // Whether the macros and design element state read from the base are still
+  // the current ones, i.e. whether the preprocessing is still valid now that
+  // the preceding files are done.
+  bool isValidSpeculation() const;
+  // Replays the changes done to this speculative unit on its base.
+  void commitSpeculation();
+
   void setInDesignElement() { m_inDesignElement = true; }
   void unsetInDesignElement() { m_inDesignElement = false; }
   bool isInDesignElement() const { return m_inDesignElement; }
@@ -55,7 +72,7 @@ class CompilationUnit {
 
   const MacroStorageRef& getMacros() const { return m_macros; }
   void deleteMacro(std::string_view macroName);
-  void deleteAllMacros() { m_macros.clear(); }
+  void deleteAllMacros();
 
   /* Following methods deal with `timescale */
   void setCurrentTimeInfo(PathId fileId);
@@ -78,11 +95,21 @@ class CompilationUnit {
   }
 
  private:
+  MacroInfo* findMacroInfo_(std::string_view macroName) const;
+
   const bool m_fileunit;
   bool m_inDesignElement;
 
   MacroStorageRef m_macros;
 
+  /* Speculative unit data */
+  CompilationUnit* const m_base = nullptr;
+  const bool m_baseInDesignElement = false;
+  bool m_baseMacrosDeleted = false;  // `undefineall
+  std::set<std::string, std::less<>> m_deletedBaseMacros;  // `undef
+  std::map<std::string, MacroInfo*, std::less<>> m_baseMacroReads;
+  std::vector<std::function<void(CompilationUnit*)>> m_changes;
+
   std::vector<TimeInfo> m_timeInfo;
   std::vector<NetTypeInfo> m_defaultNetTypes;
   TimeInfo m_noTimeInfo;
@@ -68,6 +68,8 @@ class CompileSourceFile final {
                     uint32_t lineOffset);
 
   bool compile(Action action);
+  // -verbose "processing source file" message of "action".
+  void reportProcessing(Action action);
   CompileSourceFile(const CompileSourceFile& orig);
   virtual ~CompileSourceFile();
   Compiler* getCompiler() const { return m_compiler; }
@@ -102,12 +104,37 @@ class CompileSourceFile final {
   void setSymbolTable(SymbolTable* symbols);
   void setErrorContainer(ErrorContainer* errors) { m_errors = errors; }
 
+  // Speculative preprocessing, see Compiler::preprocessSharedUnit_(): the
+  // file is preprocessed against a private layer over the shared compilation
+  // unit, concurrently with the files preceding it. Once those are done, the
+  // run is committed if the state it read is unchanged ("committed" is set,
+  // and the preprocessing status "status" is returned), otherwise it is
+  // discarded and the file has to be preprocessed again.
+  void beginSpeculativePreprocess();
+  bool endSpeculativePreprocess(bool status, bool* committed);
+  // Discards the run without committing it, for the files after a failed one.
+  void discardSpeculativePreprocess();
+
   // Get size of job approximated by size of file to process.
   uint64_t getJobSize(Action action) const;
 
+  // Wall time in seconds spent parsing the file. For a split file, the sum
+  // of the chunk parses and of the recombination.
+  double getParseSeconds() const { return m_parseSeconds; }
+
   PathId getFileId() const { return m_fileId; }
   PathId getPpOutputFileId() const { return m_ppResultFileId; }
 
+  // Preprocessor output kept in memory from the PostPreprocess step until it
+  // is parsed, so the parser does not have to read it back from disk.
+  // Empty if not available (-lowmem, -link, -parseonly, or already parsed).
+  std::string_view getPpResult() const { return m_ppResult; }
+  std::string releasePpResult() {
+    std::string result;
+    result.swap(m_ppResult);
+    return result;
+  }
+
   void setFileAnalyzer(AnalyzeFile* analyzer) { m_fileAnalyzer = analyzer; }
   AnalyzeFile* getFileAnalyzer() const { return m_fileAnalyzer; }
 
@@ -116,7 +143,12 @@ class CompileSourceFile final {
 
  private:
   bool preprocess_();
+  bool savePreprocess_();
   bool postPreprocess_();
+  void dropPreprocess_();
+  // -streaming: frees the preprocessor ANTLR handlers and outputs of the file
+  // once the output is in the hands of the parser.
+  void releasePreprocessorState_();
 
   bool parse_();
 
@@ -133,6 +165,9 @@ class CompileSourceFile final {
   CompilationUnit* m_compilationUnit = nullptr;
   Action m_action = Action::Preprocess;
   PathId m_ppResultFileId;
+  std::string m_ppResult;
+  double m_parseSeconds = 0;
+  bool m_speculative = false;
   std::map<SymbolId, PreprocessFile::AntlrParserHandler*,
            SymbolIdLessThanComparer>
       m_antlrPpMacroMap;  // Preprocessor Antlr Handlers (One per macro)
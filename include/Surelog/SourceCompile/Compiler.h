@@ -29,6 +29,7 @@ limitations under the License.
 #include <Surelog/Common/SymbolId.h>
 #include <Surelog/ErrorReporting/ErrorContainer.h>
 #include <Surelog/SourceCompile/CompileSourceFile.h>
+#include <Surelog/SourceCompile/JobCostModel.h>
 #include <Surelog/SourceCompile/PreprocessFile.h>
 #include <uhdm/vpi_user.h>
 
@@ -100,6 +101,8 @@ class Compiler {
   ErrorContainer::Stats getErrorStats() const;
   bool isLibraryFile(PathId id) const;
   const PPFileMap& getPPFileMap() { return m_ppFileMap; }
+  // Parse history of the previous run (costs, files needing LL).
+  const JobCostModel& getParseCosts() const { return m_parseCosts; }
 #ifdef USETBB
   tbb::task_group& getTaskGroup() { return m_taskGroup; }
 #endif
@@ -112,12 +115,37 @@ class Compiler {
   bool createMultiProcessPreProcessor_();
   bool createMultiProcessParser_();
   bool parseinit_();
+  // Analyzes "compiler" (large files are split in chunks) and appends the
+  // compilers to parse to "toParse".
+  void initParse_(CompileSourceFile* compiler,
+                  std::vector<CompileSourceFile*>* toParse);
   bool pythoninit_();
   bool compileFileSet_(CompileSourceFile::Action action, bool allowMultithread,
                        std::vector<CompileSourceFile*>& container);
   bool compileOneFile_(CompileSourceFile* compileSource,
                        CompileSourceFile::Action action);
+  // Preprocessing of the files sharing one compilation unit: speculatively
+  // runs all the files concurrently, then commits them in order, rerunning
+  // the ones invalidated by the macros of their predecessors.
+  bool preprocessSharedUnit_();
+  // -fileunit front end without barriers between the phases: each file is
+  // analyzed and parsed as soon as it is preprocessed, while the other files
+  // are still being preprocessed. Only the chunks of split files are left to
+  // be recombined.
+  bool usePipeline_() const;
+  bool preprocessAndParsePipelined_();
+  // Parse cost of "compiler" predicted from the previous run, the parse jobs
+  // are scheduled longest first.
+  double predictParseCost_(const CompileSourceFile* compiler) const;
+  // Records the parse costs of this run in the cache directory, returns the
+  // -profile report of the predicted vs actual costs.
+  std::string recordParseCosts_();
+  PathId getParseCostsFileId_() const;
   bool cleanup_();
+  // -profile report of the process memory and of the bytes held by the main
+  // data structures. The peak covers the phase since the previous report
+  // where the platform can reset it, the process lifetime otherwise.
+  std::string getMemoryProfile_();
 
   CommandLineParser* const m_commandLineParser;
   ErrorContainer* const m_errors;
@@ -130,7 +158,6 @@ class Compiler {
   std::vector<CompileSourceFile*> m_compilersChunkFiles;
   std::vector<CompileSourceFile*> m_compilersParentFiles;
   std::vector<CompilationUnit*> m_compilationUnits;
-  std::vector<SymbolTable*> m_symbolTables;
   std::vector<ErrorContainer*> m_errorContainers;
   LibrarySet* const m_librarySet;
   ConfigSet* const m_configSet;
@@ -140,6 +167,8 @@ class Compiler {
   std::string m_text;        // unit tests
   CompileDesign* m_compileDesign;
   PPFileMap m_ppFileMap;
+  JobCostModel m_parseCosts;
+  uint64_t m_peakResidentBytes = 0;  // Peak at the last memory report
 #ifdef USETBB
   tbb::task_group m_taskGroup;
 #endif
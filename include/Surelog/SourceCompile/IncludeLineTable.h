@@ -0,0 +1,62 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#ifndef SURELOG_INCLUDELINETABLE_H
+#define SURELOG_INCLUDELINETABLE_H
+#pragma once
+
+#include <Surelog/Common/PathId.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace SURELOG {
+
+class IncludeFileInfo;
+
+// Maps the lines of a preprocessed file back to the files and lines they come
+// from, following the include (and macro) sections of the preprocessor. The
+// lines are grouped in sorted intervals, one per section, looked up by binary
+// search: the table grows with the number of sections, not of lines.
+class IncludeLineTable final {
+ public:
+  struct Interval {
+    uint32_t m_ppStartLine = 0;  // First preprocessed line of the interval
+    bool m_inSection = false;    // Otherwise in the preprocessed file itself
+    PathId m_fileId;             // File of the section
+    int64_t m_lineOffset = 0;    // Original line = preprocessed line + offset
+  };
+
+  // "lineCount" bounds the lines of the preprocessed file.
+  void build(const std::vector<IncludeFileInfo>& infos, uint32_t lineCount);
+
+  bool empty() const { return m_intervals.empty(); }
+  uint32_t getLineCount() const { return m_lineCount; }
+  const std::vector<Interval>& getIntervals() const { return m_intervals; }
+
+  // Interval of "ppLine" in a built table. The lookups mostly walk the lines
+  // in order: "hint" keeps the last interval hit by the caller and is tried
+  // first.
+  const Interval& find(uint32_t ppLine, uint32_t* hint) const;
+
+ private:
+  std::vector<Interval> m_intervals;
+  uint32_t m_lineCount = 0;
+};
+
+}  // namespace SURELOG
+
+#endif /* SURELOG_INCLUDELINETABLE_H */
@@ -0,0 +1,81 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#ifndef SURELOG_JOBCOSTMODEL_H
+#define SURELOG_JOBCOSTMODEL_H
+#pragma once
+
+#include <Surelog/Common/PathId.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace SURELOG {
+
+// Parse cost of the files measured in the previous run, used to schedule the
+// parse jobs longest first. Files without history are estimated from their
+// size, at the average rate of the known ones. Also remembers the files the
+// SLL prediction failed on, those are parsed directly in LL mode.
+class JobCostModel final {
+ public:
+  // Loads/saves the history from/to "fileId" (in the cache directory).
+  bool load(PathId fileId);
+  bool save(PathId fileId) const;
+
+  // Text form: one "<seconds> <bytes> <LL runs> <path>" line per file.
+  void deserialize(std::string_view text);
+  std::string serialize() const;
+
+  // Predicted cost in seconds of the job on "path", "bytes" long.
+  double predict(std::string_view path, uint64_t bytes) const;
+
+  // True if the SLL parse of "path", still "bytes" long, failed in a recent
+  // run: the flag expires when the file changes, and SLL is retried every
+  // kLLRetryPeriod runs in case the failure was fixed in an included file.
+  bool needsLL(std::string_view path, uint64_t bytes) const;
+
+  // Records the measured cost of a job of this run, and whether it was
+  // parsed in LL mode. Thread-safe.
+  void record(std::string_view path, uint64_t bytes, double seconds,
+              bool parsedInLL);
+
+  bool hasHistory() const { return !m_history.empty(); }
+
+ private:
+  static constexpr uint32_t kLLRetryPeriod = 4;
+
+  struct Cost final {
+    uint64_t m_bytes = 0;
+    double m_seconds = 0;
+    // Consecutive runs parsed in LL mode, 0 if SLL succeeded.
+    uint32_t m_llRuns = 0;
+  };
+  using CostMap = std::map<std::string, Cost, std::less<>>;
+
+  CostMap m_history;
+  double m_secondsPerByte = 0;
+
+  mutable std::mutex m_mutex;
+  CostMap m_measured;
+};
+
+};  // namespace SURELOG
+
+#endif /* SURELOG_JOBCOSTMODEL_H */
@@ -43,6 +43,7 @@ class CompilationUnit;
 class ErrorContainer;
 class FileContent;
 class Library;
+class PreprocessFile;
 class SV3_1aParserBaseListener;
 class SV3_1aPythonListener;
 class SV3_1aTreeShapeListener;
@@ -76,6 +77,7 @@ class ParseFile final {
     return m_compileSourceFile;
   }
   CompilationUnit* getCompilationUnit() const { return m_compilationUnit; }
+  const std::vector<ParseFile*>& getChildren() const { return m_children; }
   Library* getLibrary() const { return m_library; }
   SymbolTable* getSymbolTable();
   ErrorContainer* getErrorContainer();
@@ -115,6 +117,13 @@ class ParseFile final {
   std::string getProfileInfo() const;
   void profileParser();
 
+  // Prediction mode of the last parse: the file was parsed in LL mode, either
+  // after a failed SLL attempt (which took "getSLLSecondsLost()"), or
+  // directly as it needed LL in a recent run ("skippedSLL()").
+  bool parsedInLL() const { return m_parsedInLL; }
+  bool skippedSLL() const { return m_skippedSLL; }
+  double getSLLSecondsLost() const { return m_sllSecondsLost; }
+
  private:
   PathId m_fileId;
   PathId m_ppFileId;
@@ -126,11 +135,21 @@ class ParseFile final {
   std::vector<LineTranslationInfo> m_lineTranslationVec;
   bool m_usingCachedVersion;
   bool m_keepParserHandler;
+  bool m_parsedInLL = false;
+  bool m_skippedSLL = false;
+  double m_sllSecondsLost = 0;
   FileContent* m_fileContent = nullptr;
   bool debug_AstModel;
 
   bool parseOneFile_(PathId fileId, uint32_t lineOffset);
-  void buildLineInfoCache_();
+  // Once the tree is walked the AST is in the FileContent: the input and
+  // token streams, the parse tree and the listener are freed, unless kept
+  // for the Python listener.
+  void releaseParserHandler_();
+  // Original file and line of a preprocessed "line" through the include
+  // line table of "pp", left untouched if the file has no include info.
+  void translateLine_(PreprocessFile* pp, uint32_t line, PathId* fileId,
+                      uint32_t* lineNb);
   // For file chunk:
   std::vector<ParseFile*> m_children;
   ParseFile* const m_parent;
@@ -139,8 +158,7 @@ class ParseFile final {
   ErrorContainer* const m_errors;
   std::string m_profileInfo;
   std::string m_sourceText;  // For Unit tests
-  std::vector<uint32_t> lineInfoCache;
-  std::vector<PathId> fileInfoCache;
+  uint32_t m_includeLineHint = 0;  // Last interval hit in translateLine_
 };
 
 };  // namespace SURELOG
@@ -29,10 +29,12 @@
 #include <Surelog/Common/PathId.h>
 #include <Surelog/Common/SymbolId.h>
 #include <Surelog/SourceCompile/IncludeFileInfo.h>
+#include <Surelog/SourceCompile/IncludeLineTable.h>
 #include <Surelog/SourceCompile/LoopCheck.h>
 
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <set>
 #include <string>
 #include <string_view>
@@ -94,6 +96,12 @@ class PreprocessFile final {
   /* Main function */
   bool preprocess();
   std::string getPreProcessedFileContent();
+  // Hands the output over to the caller, leaving this object without it.
+  std::string releasePreProcessedFileContent();
+  // -streaming: frees the output and the tree listener once the output is
+  // handed to the parser. The ANTLR handlers are owned (and freed) by the
+  // CompileSourceFile.
+  void releaseParserState();
 
   /* Macro manipulations */
   void recordMacro(std::string_view name, uint32_t startLine,
@@ -126,6 +134,7 @@ class PreprocessFile final {
     return m_compileSourceFile;
   }
   CompilationUnit* getCompilationUnit() const { return m_compilationUnit; }
+  void setCompilationUnit(CompilationUnit* unit) { m_compilationUnit = unit; }
   Library* getLibrary() const { return m_library; }
   antlr4::CommonTokenStream* getTokenStream() const {
     return m_antlrParserHandler ? m_antlrParserHandler->m_pptokens : nullptr;
@@ -143,6 +152,9 @@ class PreprocessFile final {
   const std::vector<IncludeFileInfo>& getIncludeFileInfo() const {
     return m_includeFileInfo;
   }
+  // Built from the include file info on first use, once the file is
+  // preprocessed, and shared by the parsers of all its chunks.
+  const IncludeLineTable& getIncludeLineTable();
   int32_t addIncludeFileInfo(
       IncludeFileInfo::Context context, uint32_t sectionStartLine,
       SymbolId sectionSymbolId, PathId sectionFileId,
@@ -333,6 +345,8 @@ class PreprocessFile final {
                             const std::vector<std::string>& arguments,
                             const std::vector<std::string>& tokens);
   void forgetPreprocessor_(PreprocessFile*, PreprocessFile* pp);
+  // Clears an output made of blanks only, prints it at debug level 4+.
+  void finalizeResult_();
   AntlrParserHandler* m_antlrParserHandler = nullptr;
 
   /* Only used when preprocessing a macro content */
@@ -344,6 +358,8 @@ class PreprocessFile final {
   bool m_pauseAppend = false;
   bool m_usingCachedVersion = false;
   std::vector<IncludeFileInfo> m_includeFileInfo;
+  IncludeLineTable m_includeLineTable;
+  std::once_flag m_includeLineTableBuilt;
   uint32_t m_embeddedMacroCallLine = 0;
   PathId m_embeddedMacroCallFile;
   std::string m_profileInfo;
@@ -1,4 +1,3 @@
-
 /*
  Copyright 2019 Alain Dargelas
 
@@ -26,27 +25,107 @@
 #define SURELOG_SYMBOLTABLE_H
 #pragma once
 
-#include <uhdm/SymbolFactory.h>
+#include <Surelog/Common/SymbolId.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace SURELOG {
-class SymbolTable final : public UHDM::SymbolFactory {
+
+// Concurrent string interning table.
+//
+// A single table is shared by all the compile threads: registration is
+// sharded on the symbol hash (one lock per shard), and the id -> text
+// direction is lock-free. Ids are dense, start at 0 (the bad symbol) and the
+// returned text is stable for the lifetime of the table.
+class SymbolTable final {
  public:
   // Create a snapshot of this symbol table. The returned SymbolTable contains
   // all the symbols this table has and allows to then continue using the new
   // copy without changing the original. Essentially a fork.
+  // The snapshot does not copy any data but refers to this table, which thus
+  // has to outlive it.
   // TODO: at some point, return std::unique_ptr<>
-  SymbolTable* CreateSnapshot() const { return new SymbolTable(*this); }
+  SymbolTable* CreateSnapshot() const { return new SymbolTable(this); }
 
  public:
-  SymbolTable() = default;
+  SymbolTable();
+  ~SymbolTable();
+  SymbolTable(const SymbolTable&) = delete;
   SymbolTable& operator=(const SymbolTable&) = delete;
   SymbolTable(SymbolTable&& s) = delete;
   SymbolTable& operator=(SymbolTable&&) = delete;
 
+  // Register given "symbol" string as a symbol and return its id.
+  // If this is an existing symbol, its ID is returned, otherwise a new one
+  // is created. Safe to call concurrently.
+  SymbolId registerSymbol(std::string_view symbol);
+
+  // Same as registerSymbol, also returning the stable text of the symbol.
+  std::pair<SymbolId, std::string_view> add(std::string_view symbol);
+
+  // Find id of given "symbol" or return bad-ID if it doesn't exist.
+  SymbolId getId(std::string_view symbol) const;
+
+  // Get symbol string identified by given ID or BadSymbol if it doesn't exist.
+  std::string_view getSymbol(SymbolId id) const;
+
+  // Get a vector of all symbols. As a special property, the SymbolID can be
+  // used as an index into this vector to get the corresponding text-symbol.
+  std::vector<std::string_view> getSymbols() const;
+
+  // Translate a symbol id owned by "source" into an id of this table.
+  SymbolId copyFrom(SymbolId id, const SymbolTable* source);
+
+  // Approximate number of bytes held by this table, not counting its parent.
+  size_t getMemoryUsage() const;
+
+  static std::string_view getBadSymbol() { return BadRawSymbol; }
+  static SymbolId getBadId() { return BadSymbolId; }
+  static std::string_view getEmptyMacroMarker();
+
  private:
-  // Create a snapshot of the current symbol table. Private, as this
-  // functionality should be explicitly accessed through CreateSnapshot().
-  SymbolTable(const SymbolTable& parent) = default;
+  // Create a snapshot of "parent". Private, as this functionality should be
+  // explicitly accessed through CreateSnapshot().
+  explicit SymbolTable(const SymbolTable* parent);
+
+  void appendSymbols(RawSymbolId upTo,
+                     std::vector<std::string_view>* dest) const;
+  SymbolId getParentId(std::string_view symbol) const;
+  const char* getEntry(RawSymbolId id) const;
+  std::atomic<const char*>& allocateSlot(RawSymbolId id);
+
+  // Symbol text is copied in arena blocks owned by its shard and prefixed
+  // with its length. Entries are never moved, views on them stay valid.
+  struct Shard final {
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<std::string_view, RawSymbolId> m_symbol2IdMap;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    char* m_current = nullptr;
+    size_t m_available = 0;
+    size_t m_allocated = 0;
+  };
+
+  static constexpr uint32_t kShardCount = 64;
+  // Ids are mapped to entries through buckets of growing size (the first one
+  // holding 2^kFirstBucketBits slots, each next one twice the previous), so
+  // that slots never move and can be read without locking.
+  static constexpr uint32_t kFirstBucketBits = 6;
+  static constexpr uint32_t kBucketCount = 32 - kFirstBucketBits + 1;
+
+  const SymbolTable* const m_parent = nullptr;
+  const RawSymbolId m_idOffset = 0;
+  std::atomic<RawSymbolId> m_idCounter;
+  std::array<std::atomic<std::atomic<const char*>*>, kBucketCount> m_buckets;
+  std::array<Shard, kShardCount> m_shards;
 };
 }  // namespace SURELOG
 
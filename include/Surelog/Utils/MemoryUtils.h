@@ -0,0 +1,38 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#ifndef SURELOG_MEMORYUTILS_H
+#define SURELOG_MEMORYUTILS_H
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace SURELOG::MemoryUtils {
+
+// Resident set size of the process in bytes, 0 if unknown on the platform.
+uint64_t getResidentBytes();
+
+// High-water mark of the resident set size in bytes since the process start,
+// 0 if unknown on the platform.
+uint64_t getPeakResidentBytes();
+
+// Formats "bytes" in MB for the -profile reports.
+std::string toMegaBytes(uint64_t bytes);
+
+}  // namespace SURELOG::MemoryUtils
+
+#endif /* SURELOG_MEMORYUTILS_H */
@@ -29,32 +29,43 @@
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace SURELOG {
 
-// StrCat() and StrAppend() are fairly efficient (at least as good as +/+=)
-// but more optimal implementations are possible (see absl::StrCat()
-// absl::StrAppend(). So these are in the name and spirit of the absl version
-// while being the simplest possible for now until optimization is needed.
+// StrCat() and StrAppend() are in the name and spirit of absl::StrCat() and
+// absl::StrAppend(): string-like arguments are appended directly, the others
+// are converted with their ostream operator.
+
+namespace internal {
+template <typename T>
+void strAppendOne(std::string* dest, T&& arg) {
+  if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+    dest->append(std::string_view(arg));
+  } else {
+    std::ostringstream out;
+    out << std::forward<T>(arg);
+    dest->append(out.str());
+  }
+}
+}  // namespace internal
 
 // StrCat(): concatenate the string representations of each argument into
 // a string which is returned.
 template <typename... Ts>
 std::string StrCat(Ts&&... args) {
-  std::ostringstream out;
-  (out << ... << std::forward<Ts>(args));
-  return out.str();
+  std::string result;
+  (internal::strAppendOne(&result, std::forward<Ts>(args)), ...);
+  return result;
 }
 
 // Similar to StrCat(), append arguments, converted to strings to "dest"
 // string.
 template <typename... Ts>
 void StrAppend(std::string* dest, Ts&&... args) {
-  std::ostringstream out;
-  out << *dest;
-  (out << ... << std::forward<Ts>(args));
-  *dest = out.str();
+  (internal::strAppendOne(dest, std::forward<Ts>(args)), ...);
 }
 
 namespace StringUtils {
@@ -118,6 +129,14 @@ void replaceInTokenVector(std::vector<std::string>& tokens,
 std::string replaceAll(std::string_view str, std::string_view from,
                        std::string_view to);
 
+// Erase all occurences of "what" from "str", in place.
+void eraseAll(std::string* str, std::string_view what);
+
+// Replace every "<delimiter>body<delimiter>" in "str", where body does not
+// contain a newline, with "<prefix>body<suffix>", in place.
+void replaceDelimited(std::string* str, std::string_view delimiter,
+                      std::string_view prefix, std::string_view suffix);
+
 // Given a large input, return the content of line number "line".
 // Lines are 1 indexed. The newline separator is included in the
 // returned lines; the last line in text might not have a newline
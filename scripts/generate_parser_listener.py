@@ -522,6 +522,7 @@ def _generate_VObjectTypes_h(pp_typenames: list, pa_typenames: list, filepath: s
     '#pragma once',
     '',
     '#include <cstdint>',
+    '#include <initializer_list>',
     '#include <set>',
     '#include <unordered_set>',
     '',
@@ -594,6 +595,31 @@ def _generate_VObjectTypes_h(pp_typenames: list, pa_typenames: list, filepath: s
     'typedef std::set<VObjectType> VObjectTypeSet;',
     'typedef std::unordered_set<VObjectType> VObjectTypeUnorderedSet;',
     '',
+    '// Set of VObjectType as a bitset: membership is a single bit test and no',
+    '// allocation. Meant to be built once, at compile time:',
+    '//   static constexpr VObjectTypeBitSet kTypes = {VObjectType::paX, ...};',
+    'class VObjectTypeBitSet final {',
+    ' public:',
+    '  constexpr VObjectTypeBitSet() = default;',
+    '  constexpr VObjectTypeBitSet(std::initializer_list<VObjectType> types) {',
+    '    for (VObjectType type : types) insert(type);',
+    '  }',
+    '',
+    '  constexpr void insert(VObjectType type) {',
+    '    const uint32_t index = static_cast<uint32_t>(type);',
+    '    m_words[index >> 6] |= uint64_t(1) << (index & 63);',
+    '  }',
+    '  constexpr bool contains(VObjectType type) const {',
+    '    const uint32_t index = static_cast<uint32_t>(type);',
+    '    return (m_words[index >> 6] >> (index & 63)) & 1;',
+    '  }',
+    '',
+    ' private:',
+    '  static constexpr uint32_t kWordCount =',
+    '      (static_cast<uint32_t>(VObjectType::paForcedIndexEnd) >> 6) + 1;',
+    '  uint64_t m_words[kWordCount] = {};',
+    '};',
+    '',
     '} // namespace SURELOG',
     '#endif // SURELOG_VOBJECTTYPES_H',
     ''
@@ -23,6 +23,7 @@
 #include "Surelog/Design/Design.h"
 #include "Surelog/Design/FileContent.h"
 #include "Surelog/DesignCompile/CompileDesign.h"
+#include "Surelog/ErrorReporting/ErrorContainer.h"
 #include "Surelog/SourceCompile/CompileSourceFile.h"
 #include "Surelog/SourceCompile/Compiler.h"
 #include "Surelog/SourceCompile/ParseFile.h"
@@ -49,6 +50,8 @@ void shutdown_compiler(scompiler* the_compiler) {
   if (CompileDesign* comp = compiler->getCompileDesign()) {
     comp->getSerializer().Purge();
   }
+  // The log is complete even if the caller does not print the stats
+  compiler->getErrorContainer()->flushLogFile();
   delete (Compiler*)the_compiler;
 }
 
@@ -26,6 +26,9 @@
 #include <capnp/blob.h>
 #include <capnp/list.h>
 #include <capnp/serialize-packed.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 
 #include <cstddef>
 #include <cstdint>
@@ -48,6 +51,13 @@
 #include "Surelog/ErrorReporting/Location.h"
 #include "Surelog/SourceCompile/SymbolTable.h"
 #include "Surelog/SourceCompile/VObjectTypes.h"
+#include "Surelog/config.h"
+
+#if defined(_MSC_VER)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace SURELOG {
 static constexpr std::string_view UnknownRawPath = "<unknown>";
@@ -57,6 +67,24 @@ std::string_view Cache::getExecutableTimeStamp() const {
   return sExecTstamp;
 }
 
+int32_t Cache::openForRead(PathId cacheFileId) {
+  if (!cacheFileId) return -1;
+
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  const std::string filepath =
+      fileSystem->toPlatformAbsPath(cacheFileId).string();
+
+  const int32_t fd = ::open(filepath.c_str(), O_RDONLY | O_BINARY);
+#if defined(POSIX_FADV_SEQUENTIAL)
+  if (fd >= 0) {
+    // Start fetching the whole file while the decoder consumes the head.
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+  }
+#endif
+  return fd;
+}
+
 bool Cache::checkIfCacheIsValid(const Header::Reader& header,
                                 std::string_view schemaVersion,
                                 PathId cacheFileId, PathId sourceFileId) const {
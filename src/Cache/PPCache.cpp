@@ -241,11 +241,7 @@ bool PPCache::checkCacheIsValid(PathId cacheFileId) const {
   if (clp->parseOnly() || clp->lowMem()) return true;
   if (m_pp->isMacroBody()) return false;
 
-  FileSystem* const fileSystem = FileSystem::getInstance();
-  const std::string filepath =
-      fileSystem->toPlatformAbsPath(cacheFileId).string();
-
-  const int32_t fd = ::open(filepath.c_str(), O_RDONLY | O_BINARY);
+  const int32_t fd = openForRead(cacheFileId);
   if (fd < 0) return false;
 
   bool result = false;
@@ -570,11 +566,7 @@ bool PPCache::restore(PathId cacheFileId, bool errorsOnly,
                       int32_t recursionDepth) {
   if (!cacheFileId) return false;
 
-  FileSystem* const fileSystem = FileSystem::getInstance();
-  const std::string filepath =
-      fileSystem->toPlatformAbsPath(cacheFileId).string();
-
-  const int32_t fd = ::open(filepath.c_str(), O_RDONLY | O_BINARY);
+  const int32_t fd = openForRead(cacheFileId);
   if (fd < 0) return false;
 
   bool result = true;
@@ -124,11 +124,7 @@ bool ParseCache::checkCacheIsValid(PathId cacheFileId,
 bool ParseCache::checkCacheIsValid(PathId cacheFileId) const {
   if (!cacheFileId) return false;
 
-  FileSystem* const fileSystem = FileSystem::getInstance();
-  const std::string filepath =
-      fileSystem->toPlatformAbsPath(cacheFileId).string();
-
-  const int32_t fd = ::open(filepath.c_str(), O_RDONLY | O_BINARY);
+  const int32_t fd = openForRead(cacheFileId);
   if (fd < 0) return false;
 
   bool result = false;
@@ -284,11 +280,7 @@ void ParseCache::restoreDesignElements(
 bool ParseCache::restore(PathId cacheFileId) {
   if (!cacheFileId) return false;
 
-  FileSystem* const fileSystem = FileSystem::getInstance();
-  const std::string filepath =
-      fileSystem->toPlatformAbsPath(cacheFileId).string();
-
-  const int32_t fd = ::open(filepath.c_str(), O_RDONLY | O_BINARY);
+  const int32_t fd = openForRead(cacheFileId);
   if (fd < 0) return false;
 
   bool result = true;
@@ -195,6 +195,11 @@ static const std::initializer_list<std::string_view> helpText = {
     "  -lowmem               Minimizes memory high water mark (uses multiple",
     "                        staggered processes for preproc, parsing and",
     "                        elaboration)",
+    "  -streaming            Single process low memory mode, releases the",
+    "                        preprocessor and parser state of each file as",
+    "                        soon as it is no longer needed and reports the",
+    "                        memory high water mark. Writes the",
+    "                        preprocessor output, ignored with -lowmem or -mp",
     "  -split <line number>  Split files or modules larger than specified",
     "                        line number for multi thread compilation",
     "  -timescale=<timescale>",
@@ -349,6 +354,7 @@ void CommandLineParser::logFooter() {
   std::string footers = "\n";
   footers += printStringArray(footer);
   m_errors->printToLogFile(footers);
+  m_errors->flushLogFile();
 }
 
 CommandLineParser::CommandLineParser(ErrorContainer* errors,
@@ -416,6 +422,7 @@ CommandLineParser::CommandLineParser(ErrorContainer* errors,
       m_replay(false),
       m_uhdmStats(false),
       m_lowMem(false),
+      m_streaming(false),
       m_writeUhdm(true),
       m_nonSynthesizable(false),
       m_nonSynthesizableWithFormal(false),
@@ -1071,7 +1078,9 @@ bool CommandLineParser::parseCommandLine(int32_t argc, const char** argv) {
       m_lowMem = true;
     }
 #endif
-    else if (all_arguments[i] == "-nouhdm") {
+    else if (all_arguments[i] == "-streaming") {
+      m_streaming = true;
+    } else if (all_arguments[i] == "-nouhdm") {
       m_writeUhdm = false;
     } else if (all_arguments[i] == "-mt" || all_arguments[i] == "--threads" ||
                all_arguments[i] == "-mp") {
@@ -1467,6 +1476,19 @@ bool CommandLineParser::parseCommandLine(int32_t argc, const char** argv) {
     }
   }
 
+  if (m_streaming && (m_lowMem || (m_nbMaxProcesses > 0))) {
+    // The multi-process modes hand the files over to other processes,
+    // nothing is left to stream in this one
+    Location loc(m_symbolTable->registerSymbol("-streaming"));
+    Error err(ErrorDefinition::CMD_MINUS_ARG_IGNORED, loc);
+    m_errors->addError(err);
+    m_streaming = false;
+  }
+  if (m_streaming) {
+    // The parser reads the preprocessed files back from the disk
+    m_writePpOutput = true;
+  }
+
   if (m_debugFSConfig) {
     fileSystem->printConfiguration(std::cout);
   }
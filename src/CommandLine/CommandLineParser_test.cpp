@@ -495,5 +495,53 @@ TEST(CommandLineParserTest, WorkingDirectories4) {
                  [&](const PathId& id) { return fileSystem->toPath(id); });
   EXPECT_EQ(expectedSourceFiles, actualSourceFiles);
 }
+
+TEST(CommandLineParserTest, StreamingMode) {
+  std::error_code ec;
+  const fs::path programPath = FileSystem::getProgramPath().string();
+  const fs::path testdir =
+      FileSystem::normalize(testing::TempDir()) / "streaming";
+  fs::create_directories(testdir, ec);
+  EXPECT_FALSE(ec) << ec;
+  std::ofstream strm(testdir / "top.sv");
+  EXPECT_TRUE(strm.is_open());
+  strm.close();
+
+  const std::vector<std::vector<std::string>> cases{
+      {"-streaming", "top.sv"},
+// No multiprocess on Windows platform, only multithreads
+#if !(defined(_MSC_VER) || defined(__MINGW32__) || defined(__CYGWIN__))
+      {"-streaming", "-mp", "2", "top.sv"},
+      {"-lowmem", "-streaming", "top.sv"},
+#endif
+  };
+  for (const std::vector<std::string>& options : cases) {
+    std::vector<std::string> args{programPath.string(), "-nostdout"};
+    args.insert(args.end(), options.begin(), options.end());
+    std::vector<const char*> cargs;
+    cargs.reserve(args.size());
+    std::transform(args.begin(), args.end(), std::back_inserter(cargs),
+                   [](const std::string& arg) { return arg.c_str(); });
+
+    std::unique_ptr<TestFileSystem> fileSystem(new TestFileSystem(testdir));
+    std::unique_ptr<SymbolTable> symbolTable(new SymbolTable);
+    std::unique_ptr<ErrorContainer> errors(
+        new ErrorContainer(symbolTable.get()));
+    std::unique_ptr<CommandLineParser> clp(
+        new CommandLineParser(errors.get(), symbolTable.get()));
+    clp->parseCommandLine(cargs.size(), cargs.data());
+
+    const bool alone = (options.size() == 2);
+    // Single process only, the preprocessor output is parsed from the disk
+    EXPECT_EQ(clp->streaming(), alone);
+    if (alone) EXPECT_TRUE(clp->writePpOutput());
+    // Combined with a multi-process mode, the option is reported as ignored
+    const ErrorContainer::Stats stats = errors->getErrorStats();
+    EXPECT_EQ(stats.nbWarning, alone ? 0 : 1);
+  }
+
+  fs::remove_all(testdir, ec);
+  EXPECT_FALSE(ec) << ec;
+}
 }  // namespace
 }  // namespace SURELOG
@@ -0,0 +1,67 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/Common/Containers.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace SURELOG {
+
+namespace {
+TEST(NameMapTest, Lookup) {
+  // Large enough to be indexed
+  NameMap<int32_t> names;
+  for (int32_t i = 0; i < 40; ++i) names.emplace(std::to_string(i), i);
+  EXPECT_EQ(names.size(), 40);
+  EXPECT_EQ(names.find("17")->second, 17);
+  EXPECT_EQ(names.find("40"), names.end());
+  EXPECT_FALSE(names.emplace("17", 0).second);
+
+  names.erase(names.find("17"));
+  EXPECT_EQ(names.find("17"), names.end());
+  EXPECT_EQ(names.erase("18"), 1);
+  EXPECT_EQ(names.count("18"), 0);
+  names["x"] = 5;
+  EXPECT_EQ(names.find("x")->second, 5);
+
+  // Iterates in name order
+  std::string_view previous;
+  for (const auto& entry : names) {
+    EXPECT_LT(previous, entry.first);
+    previous = entry.first;
+  }
+}
+
+TEST(NameMapTest, CopyAndMove) {
+  NameMap<int32_t> names;
+  for (int32_t i = 0; i < 20; ++i) names.emplace(std::to_string(i), i);
+  NameMap<int32_t> copy = names;
+  names.clear();
+  EXPECT_EQ(copy.find("3")->second, 3);
+  EXPECT_EQ(names.find("3"), names.end());
+
+  NameMap<int32_t> moved = std::move(copy);
+  EXPECT_EQ(moved.find("4")->second, 4);
+  moved.erase("4");
+  EXPECT_EQ(moved.find("4"), moved.end());
+  EXPECT_EQ(moved.size(), 19);
+}
+}  // namespace
+}  // namespace SURELOG
@@ -22,6 +22,7 @@
  * Created on July 1, 2017, 1:23 PM
  */
 
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <map>
@@ -88,6 +89,21 @@ void Design::addPPFileContent(PathId fileId, FileContent* content) {
   m_mutex.unlock();
 }
 
+void Design::deletePPFileContents(const std::set<FileContent*>& contents) {
+  if (contents.empty()) return;
+  m_mutex.lock();
+  m_ppFileContents.erase(
+      std::remove_if(m_ppFileContents.begin(), m_ppFileContents.end(),
+                     [&contents](const auto& entry) {
+                       return contents.find(entry.second) != contents.end();
+                     }),
+      m_ppFileContents.end());
+  m_mutex.unlock();
+  for (FileContent* content : contents) {
+    delete content;
+  }
+}
+
 DesignComponent* Design::getComponentDefinition(
     std::string_view componentName) const {
   DesignComponent* comp = (DesignComponent*)getModuleDefinition(componentName);
@@ -262,52 +278,31 @@ ModuleInstance* Design::findInstance(std::string_view path,
 ModuleInstance* Design::findInstance(const std::vector<std::string>& path,
                                      ModuleInstance* scope) const {
   if (path.empty()) return nullptr;
-  if (scope) {
-    ModuleInstance* res = findInstance_(path, scope);
-    if (res) return res;
-  } else {
-    for (auto top : m_topLevelModuleInstances) {
-      if (path.size() == 1) {
-        if (top->getInstanceName() == path[0]) {
-          return top;
-        }
-      } else {
-        if (top->getInstanceName() == path[0]) {
-          std::vector<std::string> subpath = path;
-          subpath.erase(subpath.begin());
-          ModuleInstance* res = findInstance_(subpath, top);
-          if (res) return res;
-        }
-      }
+  if (scope) return findInstance_(path, 0, scope);
+  for (auto top : m_topLevelModuleInstances) {
+    if (top->getInstanceNameView() == path[0]) {
+      if (path.size() == 1) return top;
+      ModuleInstance* res = findInstance_(path, 1, top);
+      if (res) return res;
     }
   }
-
   return nullptr;
 }
 
 ModuleInstance* Design::findInstance_(const std::vector<std::string>& path,
+                                      size_t index,
                                       ModuleInstance* scope) const {
-  if (path.empty()) return nullptr;
+  if (index >= path.size()) return nullptr;
   if (scope == nullptr) return nullptr;
-  if (path.size() == 1) {
-    if (scope->getInstanceName() == path[0]) {
-      return scope;
-    }
+  const bool last = (index + 1 == path.size());
+  if (last && (scope->getInstanceNameView() == path[index])) {
+    return scope;
   }
 
-  for (uint32_t i = 0; i < scope->getNbChildren(); i++) {
-    ModuleInstance* child = scope->getChildren(i);
-    if (path.empty()) continue;
-    if (child->getInstanceName() == path[0]) {
-      if (path.size() == 1) {
-        return child;
-      } else {
-        std::vector<std::string> subpath = path;
-        subpath.erase(subpath.begin());
-        ModuleInstance* res = findInstance(subpath, child);
-        if (res) return res;
-      }
-    }
+  for (ModuleInstance* child : scope->getChildrenByName(path[index])) {
+    if (last) return child;
+    ModuleInstance* res = findInstance_(path, index + 1, child);
+    if (res) return res;
   }
   return nullptr;
 }
@@ -464,33 +459,60 @@ void Design::orderPackages() {
   if (m_orderedPackageNames.empty()) return;
   m_orderedPackageDefinitions.resize(m_orderedPackageNames.size());
   uint32_t index = 0;
-  typedef std::map<std::string, int32_t> MultiDefCount;
-  MultiDefCount multiDefCount;
+  // The successive occurrences of a name take its successive definitions
+  std::map<std::string_view, int32_t> multiDefCount;
   for (const auto& packageName : m_orderedPackageNames) {
-    for (uint32_t i = 0; i < m_packageDefinitions.size(); i++) {
-      PackageNamePackageDefinitionMultiMap::iterator pos =
-          m_packageDefinitions.begin();
-      std::advance(pos, i);
-      std::pair<const std::string, Package*>* name_pack;
-      name_pack = &(*pos);
-
-      if (packageName == name_pack->first) {
-        MultiDefCount::iterator itr = multiDefCount.find(packageName);
-        if (itr == multiDefCount.end()) {
-          multiDefCount.emplace(packageName, 1);
-        } else {
-          int32_t level = (*itr).second;
-          (*itr).second++;
-          pos = m_packageDefinitions.begin();
-          std::advance(pos, i + level);
-          name_pack = &(*pos);
+    PackageNamePackageDefinitionMultiMap::iterator pos =
+        m_packageDefinitions.lower_bound(packageName);
+    if ((pos == m_packageDefinitions.end()) || (pos->first != packageName)) {
+      continue;
+    }
+    int32_t& level = multiDefCount[packageName];
+    for (int32_t i = 0; (i < level) && (pos != m_packageDefinitions.end());
+         ++i) {
+      ++pos;
+    }
+    ++level;
+    if (pos == m_packageDefinitions.end()) continue;
+    m_orderedPackageDefinitions[index] = pos->second;
+    index++;
+  }
+}
+
+std::vector<uint32_t> Design::computePackageLevels() const {
+  std::vector<uint32_t> levels(m_orderedPackageDefinitions.size(), 0);
+  // Only the packages ordered before a package can be compiled before it
+  std::map<std::string_view, uint32_t> packageLevels;
+  // "import p::*;", "import p::x;" and "p::x" references
+  static constexpr VObjectTypeBitSet importTypes = {
+      VObjectType::paPackage_import_item, VObjectType::paPackage_scope};
+  for (size_t i = 0, n = m_orderedPackageDefinitions.size(); i < n; ++i) {
+    const Package* pack = m_orderedPackageDefinitions[i];
+    if (pack == nullptr) continue;
+    const std::string_view packName = pack->getName();
+    uint32_t level = 0;
+    const std::vector<const FileContent*>& fileContents =
+        pack->getFileContents();
+    const std::vector<NodeId>& nodeIds = pack->getNodeIds();
+    for (size_t j = 0, m = std::min(fileContents.size(), nodeIds.size());
+         j < m; ++j) {
+      const FileContent* fC = fileContents[j];
+      if (fC == nullptr) continue;
+      for (NodeId id : fC->sl_collect_all(nodeIds[j], importTypes)) {
+        const std::string_view imported = fC->SymName(fC->Child(id));
+        if (imported == packName) continue;
+        std::map<std::string_view, uint32_t>::const_iterator itr =
+            packageLevels.find(imported);
+        if (itr != packageLevels.end()) {
+          level = std::max(level, itr->second + 1);
         }
-        m_orderedPackageDefinitions[index] = name_pack->second;
-        index++;
-        break;
       }
     }
+    levels[i] = level;
+    uint32_t& known = packageLevels[packName];
+    known = std::max(known, level);
   }
+  return levels;
 }
 
 Package* Design::addPackageDefinition(std::string_view packageName,
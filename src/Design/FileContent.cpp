@@ -412,16 +412,24 @@ NodeId FileContent::sl_get(NodeId parent, VObjectType type) const {
   return InvalidNodeId;
 }
 
-NodeId FileContent::sl_parent(NodeId parent,
-                              const VObjectTypeUnorderedSet& types,
-                              VObjectType& actualType) const {
+static bool contains(const VObjectTypeUnorderedSet& types, VObjectType type) {
+  return types.find(type) != types.end();
+}
+
+static bool contains(const VObjectTypeBitSet& types, VObjectType type) {
+  return types.contains(type);
+}
+
+template <typename TypeSet>
+NodeId FileContent::sl_parent_(NodeId parent, const TypeSet& types,
+                               VObjectType& actualType) const {
   if (!parent) return InvalidNodeId;
   if (m_objects.empty()) return InvalidNodeId;
   if (parent >= m_objects.size()) return InvalidNodeId;
   NodeId id = parent;
   while (id) {
     const VObject& current = Object(id);
-    if (types.find(current.m_type) != types.end()) {
+    if (contains(types, current.m_type)) {
       actualType = current.m_type;
       return id;
     }
@@ -430,6 +438,17 @@ NodeId FileContent::sl_parent(NodeId parent,
   return InvalidNodeId;
 }
 
+NodeId FileContent::sl_parent(NodeId parent,
+                              const VObjectTypeUnorderedSet& types,
+                              VObjectType& actualType) const {
+  return sl_parent_(parent, types, actualType);
+}
+
+NodeId FileContent::sl_parent(NodeId parent, const VObjectTypeBitSet& types,
+                              VObjectType& actualType) const {
+  return sl_parent_(parent, types, actualType);
+}
+
 NodeId FileContent::sl_parent(NodeId parent, VObjectType type) const {
   if (!parent) return InvalidNodeId;
   if (m_objects.empty()) return InvalidNodeId;
@@ -464,21 +483,22 @@ std::vector<NodeId> FileContent::sl_get_all(NodeId parent,
   return objects;
 }
 
-std::vector<NodeId> FileContent::sl_get_all(
-    NodeId parent, const VObjectTypeUnorderedSet& types) const {
+template <typename TypeSet>
+std::vector<NodeId> FileContent::sl_get_all_(NodeId parent,
+                                             const TypeSet& types) const {
   std::vector<NodeId> objects;
   if (!parent) return objects;
   if (m_objects.empty()) return objects;
   if (parent >= m_objects.size()) return objects;
   const VObject& current = Object(parent);
-  if (types.find(current.m_type) != types.end()) {
+  if (contains(types, current.m_type)) {
     objects.emplace_back(parent);
   }
 
   NodeId id = current.m_child;
   while (id) {
     const VObject& current = Object(id);
-    if (types.find(current.m_type) != types.end()) {
+    if (contains(types, current.m_type)) {
       objects.emplace_back(id);
     }
     id = current.m_sibling;
@@ -486,6 +506,16 @@ std::vector<NodeId> FileContent::sl_get_all(
   return objects;
 }
 
+std::vector<NodeId> FileContent::sl_get_all(
+    NodeId parent, const VObjectTypeUnorderedSet& types) const {
+  return sl_get_all_(parent, types);
+}
+
+std::vector<NodeId> FileContent::sl_get_all(
+    NodeId parent, const VObjectTypeBitSet& types) const {
+  return sl_get_all_(parent, types);
+}
+
 NodeId FileContent::sl_collect(NodeId parent, VObjectType type) const {
   if (!parent) return InvalidNodeId;
   if (m_objects.empty()) return InvalidNodeId;
@@ -532,8 +562,11 @@ std::vector<NodeId> FileContent::sl_collect_all(NodeId parent, VObjectType type,
   return objects;
 }
 
-std::vector<NodeId> FileContent::sl_collect_all(
-    NodeId parent, const VObjectTypeUnorderedSet& types, bool first) const {
+template <typename TypeSet>
+std::vector<NodeId> FileContent::sl_collect_all_(NodeId parent,
+                                                 const TypeSet& types,
+                                                 const TypeSet* stopPoints,
+                                                 bool first) const {
   std::vector<NodeId> objects;
   if (!parent) return objects;
   if (m_objects.empty()) return objects;
@@ -550,16 +583,31 @@ std::vector<NodeId> FileContent::sl_collect_all(
     const VObject& current = Object(id);
     // std::cout << "COLLECT:" << current.print (m_symbolTable, id,
     // GetDefinitionFile(id)) << std::endl;
-    if (types.find(current.m_type) != types.end()) {
+    if (contains(types, current.m_type)) {
       objects.emplace_back(id);
       if (first) return objects;
     }
     if (current.m_sibling) stack.emplace(current.m_sibling);
-    if (current.m_child) stack.emplace(current.m_child);
+    if (current.m_child &&
+        ((stopPoints == nullptr) || !contains(*stopPoints, current.m_type))) {
+      stack.emplace(current.m_child);
+    }
   }
   return objects;
 }
 
+std::vector<NodeId> FileContent::sl_collect_all(
+    NodeId parent, const VObjectTypeUnorderedSet& types, bool first) const {
+  return sl_collect_all_<VObjectTypeUnorderedSet>(parent, types, nullptr,
+                                                  first);
+}
+
+std::vector<NodeId> FileContent::sl_collect_all(NodeId parent,
+                                                const VObjectTypeBitSet& types,
+                                                bool first) const {
+  return sl_collect_all_<VObjectTypeBitSet>(parent, types, nullptr, first);
+}
+
 NodeId FileContent::sl_collect(NodeId parent, VObjectType type,
                                VObjectType stopPoint) const {
   if (!parent) return InvalidNodeId;
@@ -587,33 +635,13 @@ NodeId FileContent::sl_collect(NodeId parent, VObjectType type,
 std::vector<NodeId> FileContent::sl_collect_all(
     NodeId parent, const VObjectTypeUnorderedSet& types,
     const VObjectTypeUnorderedSet& stopPoints, bool first) const {
-  std::vector<NodeId> objects;
-  if (!parent) return objects;
-  if (m_objects.empty()) return objects;
-  if (parent >= m_objects.size()) return objects;
-  const VObject& current = Object(parent);
-  NodeId id = current.m_child;
-  if (!id) id = current.m_sibling;
-  if (!id) return objects;
-  std::stack<NodeId> stack;
-  stack.emplace(id);
-  while (!stack.empty()) {
-    id = stack.top();
-    stack.pop();
-    const VObject& current = Object(id);
-    // std::cout << "COLLECT:" << current.print (m_symbolTable, id,
-    // GetDefinitionFile(id)) << std::endl;
-    if (types.find(current.m_type) != types.end()) {
-      objects.emplace_back(id);
-      if (first) return objects;
-    }
-    if (current.m_sibling) stack.emplace(current.m_sibling);
-    if (current.m_child &&
-        (stopPoints.find(current.m_type) == stopPoints.end())) {
-      stack.emplace(current.m_child);
-    }
-  }
-  return objects;
+  return sl_collect_all_(parent, types, &stopPoints, first);
+}
+
+std::vector<NodeId> FileContent::sl_collect_all(
+    NodeId parent, const VObjectTypeBitSet& types,
+    const VObjectTypeBitSet& stopPoints, bool first) const {
+  return sl_collect_all_(parent, types, &stopPoints, first);
 }
 
 bool FileContent::diffTree(NodeId root, const FileContent* oFc, NodeId oroot,
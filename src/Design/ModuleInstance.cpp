@@ -25,8 +25,9 @@
 #include <uhdm/expr.h>
 #include <uhdm/uhdm_types.h>
 
+#include <algorithm>
 #include <cstdint>
-#include <set>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -53,6 +54,8 @@ using UHDM::constant;
 using UHDM::param_assign;
 using UHDM::uhdmconstant;
 
+std::atomic<uint32_t> ModuleInstance::s_fullPathStamps(0);
+
 ModuleInstance::ModuleInstance(DesignComponent* moduleDefinition,
                                const FileContent* fileContent, NodeId nodeId,
                                ModuleInstance* parent,
@@ -72,25 +75,21 @@ ModuleInstance::ModuleInstance(DesignComponent* moduleDefinition,
 }
 
 UHDM::expr* ModuleInstance::getComplexValue(std::string_view name) const {
+  if (UHDM::expr* res = ValuedComponentI::getComplexValue(name)) {
+    return res;
+  }
+
   ModuleInstance* instance = (ModuleInstance*)this;
   while (instance) {
-    UHDM::expr* res = ValuedComponentI::getComplexValue(name);
-    if (res) {
-      return res;
-    }
-
-    if (instance->m_netlist) {
-      UHDM::VectorOfparam_assign* param_assigns =
-          instance->m_netlist->param_assigns();
+    if (Netlist* netlist = instance->m_netlist) {
+      UHDM::VectorOfparam_assign* param_assigns = netlist->param_assigns();
       if (param_assigns) {
-        for (param_assign* param : *param_assigns) {
-          if (param && param->Lhs()) {
-            const std::string_view param_name = param->Lhs()->VpiName();
-            if (param_name == name) {
-              const any* exp = param->Rhs();
-              if (exp) return (UHDM::expr*)exp;
-            }
-          }
+        for (uint32_t position : netlist->getParamAssignPositions(name)) {
+          param_assign* param = (*param_assigns)[position];
+          // Skips an assignment renamed since it was indexed
+          if (param->Lhs()->VpiName() != name) continue;
+          const any* exp = param->Rhs();
+          if (exp) return (UHDM::expr*)exp;
         }
       }
     }
@@ -103,27 +102,38 @@ UHDM::expr* ModuleInstance::getComplexValue(std::string_view name) const {
   return nullptr;
 }
 
-const UHDM::constant* resolveFromParamAssign(
-    const UHDM::VectorOfparam_assign* param_assigns,
-    std::set<std::string>& visited, const std::string_view& name) {
-  std::string s(name);
-  if (visited.find(s) != visited.end()) {
+// Follows the chain of parameters assigned to parameters down to a constant.
+// Uses the index of the netlist owning "param_assigns", if any.
+static const UHDM::constant* resolveFromParamAssign(
+    const UHDM::VectorOfparam_assign* param_assigns, Netlist* netlist,
+    std::vector<std::string_view>& visited, std::string_view name) {
+  if (std::find(visited.begin(), visited.end(), name) != visited.end()) {
     return nullptr;
   }
-  visited.insert(std::string(name));
-  for (param_assign* param : *param_assigns) {
-    const std::string_view param_name = param->Lhs()->VpiName();
-    if (param_name == name) {
-      const any* exp = param->Rhs();
-      if (exp) {
-        if (exp->UhdmType() == uhdmconstant) {
-          return (constant*)exp;
-        } else if (exp->UhdmType() == UHDM::uhdmref_obj) {
-          UHDM::ref_obj* ref = (UHDM::ref_obj*)exp;
-          const std::string_view ref_name = ref->VpiName();
-          return resolveFromParamAssign(param_assigns, visited, ref_name);
-        }
-      }
+  visited.emplace_back(name);
+  // Returns true if "param" decides the resolution
+  const UHDM::constant* result = nullptr;
+  auto resolve = [&](const param_assign* param) {
+    if (param->Lhs()->VpiName() != name) return false;
+    const any* exp = param->Rhs();
+    if (exp == nullptr) return false;
+    if (exp->UhdmType() == uhdmconstant) {
+      result = (constant*)exp;
+      return true;
+    } else if (exp->UhdmType() == UHDM::uhdmref_obj) {
+      const std::string_view ref_name = ((UHDM::ref_obj*)exp)->VpiName();
+      result = resolveFromParamAssign(param_assigns, netlist, visited, ref_name);
+      return true;
+    }
+    return false;
+  };
+  if (netlist) {
+    for (uint32_t position : netlist->getParamAssignPositions(name)) {
+      if (resolve((*param_assigns)[position])) return result;
+    }
+  } else {
+    for (const param_assign* param : *param_assigns) {
+      if (resolve(param)) return result;
     }
   }
   return nullptr;
@@ -138,15 +148,15 @@ Value* ModuleInstance::getValue(std::string_view name,
     return nullptr;
   }
 
+  std::vector<std::string_view> visited;
   ModuleInstance* instance = (ModuleInstance*)this;
   while (instance) {
-    if (instance->m_netlist) {
-      UHDM::VectorOfparam_assign* param_assigns =
-          instance->m_netlist->param_assigns();
+    if (Netlist* netlist = instance->m_netlist) {
+      UHDM::VectorOfparam_assign* param_assigns = netlist->param_assigns();
       if (param_assigns) {
-        std::set<std::string> visited;
+        visited.clear();
         const UHDM::constant* res =
-            resolveFromParamAssign(param_assigns, visited, name);
+            resolveFromParamAssign(param_assigns, netlist, visited, name);
         if (res) {
           sval = exprBuilder.fromVpiValue(res->VpiValue(), res->VpiSize());
           break;
@@ -168,9 +178,9 @@ Value* ModuleInstance::getValue(std::string_view name,
     UHDM::VectorOfparam_assign* param_assigns =
         m_definition->getParam_assigns();
     if (param_assigns) {
-      std::set<std::string> visited;
+      visited.clear();
       const UHDM::constant* res =
-          resolveFromParamAssign(param_assigns, visited, name);
+          resolveFromParamAssign(param_assigns, nullptr, visited, name);
       if (res) {
         sval = exprBuilder.fromVpiValue(res->VpiValue(), res->VpiSize());
       }
@@ -181,10 +191,24 @@ Value* ModuleInstance::getValue(std::string_view name,
 }
 
 ModuleInstance* ModuleInstance::getChildByName(std::string_view name) {
-  for (auto child : m_allSubInstances) {
-    if (child->getInstanceName() == name) return child;
+  const std::vector<ModuleInstance*>& children = getChildrenByName(name);
+  return children.empty() ? nullptr : children.front();
+}
+
+const std::vector<ModuleInstance*>& ModuleInstance::getChildrenByName(
+    std::string_view name) {
+  static const std::vector<ModuleInstance*> kNoChildren;
+  if (m_indexedChildCount > m_allSubInstances.size()) {
+    m_childrenByName.clear();
+    m_indexedChildCount = 0;
   }
-  return nullptr;
+  for (; m_indexedChildCount < m_allSubInstances.size();
+       ++m_indexedChildCount) {
+    ModuleInstance* child = m_allSubInstances[m_indexedChildCount];
+    m_childrenByName[child->getInstanceNameView()].push_back(child);
+  }
+  auto itr = m_childrenByName.find(name);
+  return (itr == m_childrenByName.end()) ? kNoChildren : itr->second;
 }
 
 std::string ModuleInstance::decompile(char* valueName) {
@@ -252,31 +276,40 @@ uint16_t ModuleInstance::getEndColumnNb() const {
 }
 
 SymbolId ModuleInstance::getFullPathId(SymbolTable* symbols) const {
-  return symbols->registerSymbol(getFullPathName());
+  return symbols->registerSymbol(getFullPathNameView());
 }
 
 SymbolId ModuleInstance::getInstanceId(SymbolTable* symbols) const {
-  return symbols->registerSymbol(getInstanceName());
+  return symbols->registerSymbol(getInstanceNameView());
 }
 SymbolId ModuleInstance::getModuleNameId(SymbolTable* symbols) const {
   return symbols->registerSymbol(getModuleName());
 }
 
 std::string ModuleInstance::getFullPathName() const {
-  std::string path;
-  const ModuleInstance* tmp = this;
-  std::vector<std::string> nibbles;
-  while (tmp) {
-    nibbles.push_back(tmp->getInstanceName());
-    tmp = tmp->getParent();
+  return std::string(getFullPathNameView());
+}
+
+std::string_view ModuleInstance::getFullPathNameView() const {
+  uint32_t parentStamp = 0;
+  if (m_parent) {
+    // Brings the paths of the ancestors up to date first
+    m_parent->getFullPathNameView();
+    parentStamp = m_parent->m_fullPathStamp;
   }
-  for (int32_t i = nibbles.size() - 1; i >= 0; i--) {
-    path += nibbles[i];
-    if (i > 0) {
-      path += ".";
+  if ((m_fullPathStamp == 0) || (m_fullPathParent != m_parent) ||
+      (m_fullPathParentStamp != parentStamp)) {
+    if (m_parent) {
+      m_fullPathName.assign(m_parent->m_fullPathName).append(".");
+    } else {
+      m_fullPathName.clear();
     }
+    m_fullPathName.append(getInstanceNameView());
+    m_fullPathParent = m_parent;
+    m_fullPathParentStamp = parentStamp;
+    m_fullPathStamp = ++s_fullPathStamps;
   }
-  return path;
+  return m_fullPathName;
 }
 
 uint32_t ModuleInstance::getDepth() const {
@@ -290,10 +323,12 @@ uint32_t ModuleInstance::getDepth() const {
 }
 
 std::string ModuleInstance::getInstanceName() const {
+  return std::string(getInstanceNameView());
+}
+
+std::string_view ModuleInstance::getInstanceNameView() const {
   if (m_definition == nullptr) {
-    std::string name =
-        m_instName.substr(m_instName.find("&", 0, 1) + 1, m_instName.size());
-    return name;
+    return std::string_view(m_instName).substr(m_instName.find("&", 0, 1) + 1);
   } else {
     return m_instName;
   }
@@ -369,7 +404,7 @@ void ModuleInstance::overrideParentChild(ModuleInstance* parent,
     }
   }
 
-  child->m_parent = this;
+  child->setParent(this);
   std::vector<ModuleInstance*> children;
 
   for (ModuleInstance* sub_instance : m_allSubInstances) {
@@ -383,6 +418,8 @@ void ModuleInstance::overrideParentChild(ModuleInstance* parent,
   }
 
   m_allSubInstances = children;
+  m_childrenByName.clear();
+  m_indexedChildCount = 0;
 }
 
 void ModuleInstance::setOverridenParam(std::string_view name) {
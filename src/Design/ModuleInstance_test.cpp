@@ -0,0 +1,86 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/Design/ModuleInstance.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Surelog/Common/NodeId.h"
+
+namespace SURELOG {
+using testing::ElementsAre;
+
+namespace {
+TEST(ModuleInstanceTest, ChildrenByName) {
+  ModuleInstanceFactory factory;
+  ModuleInstance* top = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, nullptr, "top", "work@top");
+  ModuleInstance* u1 = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, top, "u1", "work@sub");
+  top->addSubInstance(u1);
+  EXPECT_EQ(top->getInstanceName(), "top");
+  EXPECT_EQ(top->getModuleName(), "work@top");
+  EXPECT_EQ(top->getChildByName("u1"), u1);
+  EXPECT_EQ(top->getChildByName("u2"), nullptr);
+
+  // The elaboration also appends to the children vector directly.
+  ModuleInstance* u2 = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, top, "u2", "work@sub");
+  ModuleInstance* u2bis = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, top, "u2", "work@other");
+  top->getAllSubInstances().push_back(u2);
+  top->getAllSubInstances().push_back(u2bis);
+  EXPECT_EQ(top->getChildByName("u2"), u2);
+  EXPECT_THAT(top->getChildrenByName("u2"), ElementsAre(u2, u2bis));
+  EXPECT_TRUE(top->getChildrenByName("top").empty());
+  EXPECT_EQ(u2->getFullPathName(), "top.u2");
+
+  delete top;
+}
+
+TEST(ModuleInstanceTest, FullPathName) {
+  ModuleInstanceFactory factory;
+  ModuleInstance* top = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, nullptr, "top", "work@top");
+  ModuleInstance* mid = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, top, "mid", "work@mid");
+  ModuleInstance* leaf = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, nullptr, "leaf", "work@leaf");
+  top->addSubInstance(mid);
+  mid->addSubInstance(leaf);
+  EXPECT_EQ(leaf->getFullPathNameView(), "leaf");
+
+  // Bound later in the hierarchy
+  leaf->setParent(mid);
+  EXPECT_EQ(leaf->getFullPathNameView(), "top.mid.leaf");
+  EXPECT_EQ(leaf->getFullPathName(), "top.mid.leaf");
+  EXPECT_EQ(mid->getFullPathNameView(), "top.mid");
+
+  // Moving an inner instance updates the paths of its whole subtree.
+  ModuleInstance* other = factory.newModuleInstance(
+      nullptr, nullptr, InvalidNodeId, nullptr, "other", "work@other");
+  mid->setParent(other);
+  EXPECT_EQ(leaf->getFullPathNameView(), "other.mid.leaf");
+  EXPECT_EQ(top->getFullPathNameView(), "top");
+
+  delete other;
+  delete top;
+}
+}  // namespace
+}  // namespace SURELOG
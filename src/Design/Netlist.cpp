@@ -23,6 +23,14 @@
 
 #include "Surelog/Design/Netlist.h"
 
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// UHDM
+#include <uhdm/param_assign.h>
+#include <uhdm/uhdm.h>
+
 namespace SURELOG {
 
 Netlist::~Netlist() {  // NOLINT(modernize-use-equals-default)
@@ -43,4 +51,27 @@ Netlist::~Netlist() {  // NOLINT(modernize-use-equals-default)
   */
 }
 
+const std::vector<uint32_t>& Netlist::getParamAssignPositions(
+    std::string_view name) {
+  static const std::vector<uint32_t> kNoPositions;
+  if (m_param_assigns == nullptr) return kNoPositions;
+  if ((m_indexedParamAssigns != m_param_assigns) ||
+      (m_indexedParamAssignCount > m_param_assigns->size())) {
+    m_paramAssignPositions.clear();
+    m_indexedParamAssignCount = 0;
+    m_indexedParamAssigns = m_param_assigns;
+  }
+  for (; m_indexedParamAssignCount < m_param_assigns->size();
+       ++m_indexedParamAssignCount) {
+    const UHDM::param_assign* param =
+        (*m_param_assigns)[m_indexedParamAssignCount];
+    if (param && param->Lhs()) {
+      m_paramAssignPositions[param->Lhs()->VpiName()].push_back(
+          m_indexedParamAssignCount);
+    }
+  }
+  auto itr = m_paramAssignPositions.find(name);
+  return (itr == m_paramAssignPositions.end()) ? kNoPositions : itr->second;
+}
+
 }  // namespace SURELOG
@@ -25,7 +25,6 @@
 #include <uhdm/expr.h>
 
 #include <cstdint>
-#include <map>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -68,8 +67,7 @@ Value* ValuedComponentI::getValue(std::string_view name,
 
 void ValuedComponentI::deleteValue(std::string_view name,
                                    ExprBuilder& exprBuilder) {
-  std::map<std::string, std::pair<Value*, int32_t>>::iterator itr =
-      m_paramMap.find(name);
+  ParamMap::iterator itr = m_paramMap.find(name);
   if (itr != m_paramMap.end()) {
     exprBuilder.deleteValue((*itr).second.first);
     m_paramMap.erase(itr);
@@ -77,8 +75,7 @@ void ValuedComponentI::deleteValue(std::string_view name,
 }
 
 void ValuedComponentI::forgetValue(std::string_view name) {
-  std::map<std::string, std::pair<Value*, int32_t>>::iterator itr =
-      m_paramMap.find(name);
+  ParamMap::iterator itr = m_paramMap.find(name);
   if (itr != m_paramMap.end()) {
     m_paramMap.erase(itr);
   }
@@ -55,6 +55,9 @@
 #include "Surelog/SourceCompile/SymbolTable.h"
 #include "Surelog/Testbench/ClassDefinition.h"
 #include "Surelog/Testbench/Program.h"
+#include "Surelog/Utils/MemoryUtils.h"
+#include "Surelog/Utils/StringUtils.h"
+#include "Surelog/Utils/Timer.h"
 
 // UHDM
 #include <uhdm/include_file_info.h>
@@ -62,8 +65,10 @@
 #include <uhdm/uhdm_types.h>
 #include <uhdm/vpi_visitor.h>
 
+#include <algorithm>
 #include <climits>
 #include <cstdint>
+#include <filesystem>
 #include <iostream>
 #include <map>
 #include <string>
@@ -82,6 +87,7 @@ CompileDesign::CompileDesign(Compiler* compiler) : m_compiler(compiler) {}
 CompileDesign::~CompileDesign() {
   // TODO: ownership not clear.
   // delete m_compiler;
+  waitForUhdmSave();
   m_serializer.Purge();
 }
 
@@ -132,7 +138,7 @@ void CompileDesign::compileMT_(ObjectMapType& objects, int32_t maxThreadCount) {
   if (maxThreadCount == 0) {
     for (const auto& itr : objects) {
       FunctorType funct(this, itr.second, m_compiler->getDesign(),
-                        m_symbolTables[0], m_errorContainers[0]);
+                        m_compiler->getSymbolTable(), m_errorContainers[0]);
       funct.operator()();
     }
   } else {
@@ -171,7 +177,7 @@ void CompileDesign::compileMT_(ObjectMapType& objects, int32_t maxThreadCount) {
       std::thread* th = new std::thread([=] {
         for (uint32_t j = 0; j < jobArray[i].size(); j++) {
           FunctorType funct(this, jobArray[i][j], m_compiler->getDesign(),
-                            m_symbolTables[i], m_errorContainers[i]);
+                            m_compiler->getSymbolTable(), m_errorContainers[i]);
           funct.operator()();
         }
       });
@@ -304,11 +310,9 @@ bool CompileDesign::compilation_() {
 
   int32_t index = 0;
   do {
-    SymbolTable* symbols =
-        m_compiler->getCommandLineParser()->getSymbolTable()->CreateSnapshot();
-    m_symbolTables.push_back(symbols);
-    ErrorContainer* errors = new ErrorContainer(
-        symbols, m_compiler->getErrorContainer()->getLogListener());
+    ErrorContainer* errors =
+        new ErrorContainer(m_compiler->getSymbolTable(),
+                           m_compiler->getErrorContainer()->getLogListener());
     errors->registerCmdLine(m_compiler->getCommandLineParser());
     m_errorContainers.push_back(errors);
     index++;
@@ -332,10 +336,38 @@ bool CompileDesign::compilation_() {
   collectObjects_(all_files, design, false);
   m_compiler->getDesign()->orderPackages();
 
-  // Compile packages in strict order
+  if (m_compiler->getCommandLineParser()->profile()) {
+    // Packages of a level only import packages of the lower levels, the
+    // number of levels is the critical path of the package compilation
+    // orderPackages() leaves a null slot for each name it cannot resolve
+    const std::vector<Package*>& packages =
+        m_compiler->getDesign()->getOrderedPackageDefinitions();
+    const std::vector<uint32_t> levels =
+        m_compiler->getDesign()->computePackageLevels();
+    uint32_t packageCount = 0;
+    std::vector<uint32_t> levelSizes;
+    for (size_t i = 0, n = std::min(packages.size(), levels.size()); i < n;
+         ++i) {
+      if (packages[i] == nullptr) continue;
+      ++packageCount;
+      if (levels[i] >= levelSizes.size()) levelSizes.resize(levels[i] + 1, 0);
+      ++levelSizes[levels[i]];
+    }
+    uint32_t widest = 0;
+    for (uint32_t size : levelSizes) widest = std::max(widest, size);
+    StrAppend(&m_compileProfile, "Package graph: ", packageCount,
+              " packages, ", levelSizes.size(),
+              " levels (critical path), widest level ", widest,
+              " packages\n");
+  }
+
+  // Compile packages in strict order. The packages of a level could compile
+  // concurrently (the symbol table is thread safe), but compiling a package
+  // creates its UHDM objects in the one serializer, which is not.
   for (auto itr : m_compiler->getDesign()->getOrderedPackageDefinitions()) {
     FunctorCompilePackage funct(this, itr, m_compiler->getDesign(),
-                                m_symbolTables[0], m_errorContainers[0]);
+                                m_compiler->getSymbolTable(),
+                                m_errorContainers[0]);
     funct.operator()();
   }
 
@@ -392,11 +424,9 @@ bool CompileDesign::compilation_() {
 
   m_compiler->getDesign()->orderPackages();
 
-  uint32_t size = m_symbolTables.size();
-  for (uint32_t i = 0; i < size; i++) {
-    m_compiler->getErrorContainer()->appendErrors(*m_errorContainers[i]);
-    delete m_symbolTables[i];
-    delete m_errorContainers[i];
+  for (ErrorContainer* errors : m_errorContainers) {
+    m_compiler->getErrorContainer()->appendErrors(*errors);
+    delete errors;
   }
   return true;
 }
@@ -426,6 +456,50 @@ vpiHandle CompileDesign::writeUHDM(PathId fileId) {
   return h;
 }
 
+void CompileDesign::saveUhdm(PathId fileId) {
+  waitForUhdmSave();
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  m_uhdmSaveFileId = fileId;
+  Timer tmr;
+  m_serializer.Save(fileSystem->toPlatformAbsPath(fileId));
+  m_uhdmSaveSeconds = tmr.elapsed();
+  profileUhdmSave_();
+}
+
+void CompileDesign::saveUhdmAsync(PathId fileId) {
+  waitForUhdmSave();
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  const std::filesystem::path uhdmFile =
+      fileSystem->toPlatformAbsPath(fileId);
+  m_uhdmSaveFileId = fileId;
+  m_uhdmSaveThread = new std::thread([this, uhdmFile] {
+    Timer tmr;
+    m_serializer.Save(uhdmFile);
+    m_uhdmSaveSeconds = tmr.elapsed();
+  });
+}
+
+void CompileDesign::waitForUhdmSave() {
+  if (m_uhdmSaveThread == nullptr) return;
+  m_uhdmSaveThread->join();
+  delete m_uhdmSaveThread;
+  m_uhdmSaveThread = nullptr;
+  profileUhdmSave_();
+}
+
+void CompileDesign::profileUhdmSave_() {
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  std::streamsize bytes = 0;
+  if (!fileSystem->filesize(m_uhdmSaveFileId, &bytes)) bytes = 0;
+  const double megaBytesPerSecond =
+      (m_uhdmSaveSeconds > 0)
+          ? (bytes / (1024.0 * 1024.0) / m_uhdmSaveSeconds)
+          : 0.0;
+  StrAppend(&m_uhdmProfile, "UHDM save of ", MemoryUtils::toMegaBytes(bytes),
+            " took ", StringUtils::to_string(m_uhdmSaveSeconds), "s (",
+            StringUtils::to_string(megaBytesPerSecond, 1), " MB/s)\n");
+}
+
 void decompile(ValuedComponentI* instance) {
   FileSystem* const fileSystem = FileSystem::getInstance();
   if (instance) {
@@ -77,6 +77,7 @@
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <string>
 #include <string_view>
@@ -87,6 +88,16 @@ namespace SURELOG {
 
 using namespace UHDM;  // NOLINT (we use a good chunk of these here)
 
+// Entries of "map" an import brings into scope, all of them or only "name"
+// for the import of a single item.
+template <typename Map>
+static std::pair<typename Map::const_iterator, typename Map::const_iterator>
+importedEntries(const Map& map, std::string_view name) {
+  if (name.empty()) return {map.begin(), map.end()};
+  typename Map::const_iterator itr = map.find(name);
+  return {itr, (itr == map.end()) ? itr : std::next(itr)};
+}
+
 void CompileHelper::checkForLoops(bool on) {
   m_checkForLoops = on;
   m_stackLevel = 0;
@@ -155,18 +166,16 @@ bool CompileHelper::importPackage(DesignComponent* scope, Design* design,
     }
     // Typespecs
     auto& typeSet = def->getDataTypeMap();
-    for (auto& type : typeSet) {
-      if (!object_name.empty()) {
-        if (type.first != object_name) continue;
-      }
+    for (auto [itr, last] = importedEntries(typeSet, object_name); itr != last;
+         ++itr) {
+      const auto& type = *itr;
       scope->insertDataType(type.first, type.second);
     }
     // Variables
     auto& variableSet = def->getVariables();
-    for (auto& var : variableSet) {
-      if (!object_name.empty()) {
-        if (var.first != object_name) continue;
-      }
+    for (auto [itr, last] = importedEntries(variableSet, object_name);
+         itr != last; ++itr) {
+      const auto& var = *itr;
       scope->addVariable(var.second);
       Value* val = def->getValue(var.first);
       if (val) {
@@ -191,10 +200,9 @@ bool CompileHelper::importPackage(DesignComponent* scope, Design* design,
 
     // Type parameters
     auto& paramSet = def->getParameterMap();
-    for (auto& param : paramSet) {
-      if (!object_name.empty()) {
-        if (param.first != object_name) continue;
-      }
+    for (auto [itr, last] = importedEntries(paramSet, object_name);
+         itr != last; ++itr) {
+      const auto& param = *itr;
       Parameter* orig = param.second;
       Parameter* clone = new Parameter(*orig);
       clone->setImportedPackage(pack_name);
@@ -276,18 +284,17 @@ bool CompileHelper::importPackage(DesignComponent* scope, Design* design,
 
     // Values (from enum declarations...)
     auto& values = def->getMappedValues();
-    for (auto& mvalue : values) {
-      if (!object_name.empty()) {
-        if (mvalue.first != object_name) continue;
-      }
+    for (auto [itr, last] = importedEntries(values, object_name); itr != last;
+         ++itr) {
+      const auto& mvalue = *itr;
       if (mvalue.second.first->isValid())
         scope->setValue(mvalue.first, m_exprBuilder.clone(mvalue.second.first),
                         m_exprBuilder, mvalue.second.second);
     }
-    for (auto& cvalue : def->getComplexValues()) {
-      if (!object_name.empty()) {
-        if (cvalue.first != object_name) continue;
-      }
+    auto& complexValues = def->getComplexValues();
+    for (auto [itr, last] = importedEntries(complexValues, object_name);
+         itr != last; ++itr) {
+      const auto& cvalue = *itr;
       scope->setComplexValue(cvalue.first, cvalue.second);
     }
 
@@ -733,14 +740,6 @@ const DataType* CompileHelper::compileTypeDef(DesignComponent* scope,
       }
     }
 
-    if (scope) {
-      DesignComponent::DataTypeMap dmap = scope->getDataTypeMap();
-      DesignComponent::DataTypeMap::iterator itr = dmap.find(name);
-      if (itr != dmap.end()) {
-        dmap.erase(itr);
-      }
-    }
-
     type->setDefinition(newTypeDef);
     if (scope) scope->insertTypeDef(newTypeDef);
     newType = newTypeDef;
@@ -2679,7 +2678,7 @@ void CompileHelper::compileUdpInstantiation(ModuleDefinition* mod,
                                             CompileDesign* compileDesign,
                                             NodeId id,
                                             ValuedComponentI* instance) {
-  VObjectTypeUnorderedSet insttypes = {VObjectType::paUdp_instance};
+  static constexpr VObjectTypeBitSet insttypes = {VObjectType::paUdp_instance};
   UHDM::Serializer& s = compileDesign->getSerializer();
   std::vector<NodeId> hierInstIds = fC->sl_collect_all(id, insttypes, true);
   NodeId hierInstId;
@@ -1235,7 +1235,8 @@ bool CompileModule::collectInterfaceObjects_(CollectType collectType) {
         case VObjectType::paGenerate_interface_item: {
           if (collectType != CollectType::OTHER) break;
           // TODO: rewrite this rough implementation
-          VObjectTypeUnorderedSet types = {VObjectType::paModport_item};
+          static constexpr VObjectTypeBitSet types = {
+              VObjectType::paModport_item};
           std::vector<NodeId> items = fC->sl_collect_all(id, types);
           for (auto nodeId : items) {
             Location loc(fC->getFileId(nodeId), fC->Line(nodeId),
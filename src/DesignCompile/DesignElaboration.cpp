@@ -637,7 +637,7 @@ ModuleInstance* DesignElaboration::createBindInstance_(
   bool instanceMatch = true;
   if (targetInstId) {
     const std::string_view targetInstName = fC->SymName(targetInstId);
-    instanceMatch = (targetInstName == parent->getInstanceName());
+    instanceMatch = (targetInstName == parent->getInstanceNameView());
   }
   DesignComponent* targetDef = nullptr;
   if (def && (def->getName() == targetName) && instanceMatch) {
@@ -830,7 +830,7 @@ void DesignElaboration::elaborateInstance_(
   Design* design = m_compileDesign->getCompiler()->getDesign();
   for (const auto& name : params) {
     DefParam* defparam =
-        design->getDefParam(StrCat(parent->getFullPathName(), ".", name));
+        design->getDefParam(StrCat(parent->getFullPathNameView(), ".", name));
     if (defparam) {
       Value* value = defparam->getValue();
       if (value) {
@@ -842,7 +842,7 @@ void DesignElaboration::elaborateInstance_(
   bindDataTypes_(parent, parent->getDefinition());
 
   // Scan for regular instances and generate blocks
-  VObjectTypeUnorderedSet types = {
+  static constexpr VObjectTypeBitSet types = {
       VObjectType::paUdp_instantiation, VObjectType::paModule_instantiation,
       VObjectType::paInterface_instantiation,
       VObjectType::paProgram_instantiation, VObjectType::paGate_instantiation,
@@ -856,7 +856,7 @@ void DesignElaboration::elaborateInstance_(
       VObjectType::paPar_block, VObjectType::paSeq_block,
       VObjectType::paGenerate_region, VObjectType::paGenerate_begin_end_block};
 
-  VObjectTypeUnorderedSet stopPoints = {
+  static constexpr VObjectTypeBitSet stopPoints = {
       VObjectType::paConditional_generate_construct,
       VObjectType::paGenerate_module_conditional_statement,
       VObjectType::paGenerate_interface_conditional_statement,
@@ -1038,7 +1038,7 @@ void DesignElaboration::elaborateInstance_(
           modName = genBlkBaseName + append + std::to_string(genBlkIndex);
           append += "0";
         }
-        VObjectTypeUnorderedSet btypes = {
+        static constexpr VObjectTypeBitSet btypes = {
             VObjectType::paGenerate_module_block,
             VObjectType::paGenerate_interface_block,
             VObjectType::paGenerate_begin_end_block,
@@ -1050,8 +1050,8 @@ void DesignElaboration::elaborateInstance_(
         instName = modName;
         std::string fullName;
         std::string_view libName = fC->getLibrary()->getName();
-        if (instName == parent->getInstanceName()) {
-          fullName += parent->getFullPathName();
+        if (instName == parent->getInstanceNameView()) {
+          fullName += parent->getFullPathNameView();
           reuseInstance = true;
         } else {
           StrAppend(&fullName, parent->getModuleName(), ".", instName);
@@ -1116,9 +1116,9 @@ void DesignElaboration::elaborateInstance_(
           while (cont) {
             Value* currentIndexValue = parent->getValue(name, m_exprBuilder);
             uint64_t currVal = currentIndexValue->getValueUL();
-            std::string indexedModName = parent->getFullPathName() + "." +
-                                         modName + "[" +
-                                         std::to_string(currVal) + "]";
+            std::string indexedModName =
+                StrCat(parent->getFullPathNameView(), ".", modName, "[",
+                       std::to_string(currVal), "]");
             instName = modName + "[" + std::to_string(currVal) + "]";
 
             def = design->getComponentDefinition(indexedModName);
@@ -1472,7 +1472,8 @@ void DesignElaboration::elaborateInstance_(
           modName = fC->SymName(blockNameId);
           instName = modName;
         }
-        std::string indexedModName = parent->getFullPathName() + "." + modName;
+        std::string indexedModName =
+            StrCat(parent->getFullPathNameView(), ".", modName);
         def = design->getComponentDefinition(indexedModName);
         if (def == nullptr) {
           def = m_moduleDefFactory->newModuleDefinition(fC, blockId,
@@ -1691,7 +1692,7 @@ void DesignElaboration::elaborateInstance_(
           paramOverride = tmpId;
         }
 
-        VObjectTypeUnorderedSet insttypes = {
+        static constexpr VObjectTypeBitSet insttypes = {
             VObjectType::paHierarchical_instance,
             VObjectType::paN_input_gate_instance,
             VObjectType::paN_output_gate_instance,
@@ -1715,7 +1716,8 @@ void DesignElaboration::elaborateInstance_(
           }
 
           auto itr =
-              m_instUseClause.find(parent->getFullPathName() + "." + instName);
+              m_instUseClause.find(
+                  StrCat(parent->getFullPathNameView(), ".", instName));
           if (itr != m_instUseClause.end()) {
             UseClause& use = (*itr).second;
             switch (use.getType()) {
@@ -2015,7 +2017,7 @@ std::vector<std::string_view> DesignElaboration::collectParams_(
     }
     const FileContent* parentFile =
         instance->getParent()->getDefinition()->getFileContents()[0];
-    VObjectTypeUnorderedSet types = {
+    static constexpr VObjectTypeBitSet types = {
         VObjectType::paOrdered_parameter_assignment,
         VObjectType::paNamed_parameter_assignment};
     std::vector<NodeId> overrideParams =
@@ -2316,8 +2318,9 @@ std::vector<std::string_view> DesignElaboration::collectParams_(
   }
 
   // Defparams
-  VObjectTypeUnorderedSet types = {VObjectType::paDefparam_assignment};
-  VObjectTypeUnorderedSet stopPoints = {
+  static constexpr VObjectTypeBitSet types = {
+      VObjectType::paDefparam_assignment};
+  static constexpr VObjectTypeBitSet stopPoints = {
       VObjectType::paConditional_generate_construct,
       VObjectType::paGenerate_module_conditional_statement,
       VObjectType::paGenerate_interface_conditional_statement,
@@ -2371,12 +2374,12 @@ std::vector<std::string_view> DesignElaboration::collectParams_(
     if (design->findInstance(pathRoot)) {
       std::string p = design->findInstance(pathRoot)->getFullPathName();
       if (p.find('.') != std::string::npos) {
-        prefix.assign(instance->getFullPathName()).append(".");
+        prefix.assign(instance->getFullPathNameView()).append(".");
       } else {
         prefix.assign(fC->getLibrary()->getName()).append("@");
       }
     } else {
-      prefix = instance->getFullPathName() + ".";
+      prefix = StrCat(instance->getFullPathNameView(), ".");
     }
     path = StrCat(prefix, path);
     Value* val = m_exprBuilder.evalExpr(fC, value, instance);
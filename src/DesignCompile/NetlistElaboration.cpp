@@ -769,7 +769,7 @@ ModuleInstance* NetlistElaboration::getInterfaceInstance_(
         }
         if (formalName == portName) {
           for (auto inst : parent->getAllSubInstances()) {
-            if (inst->getInstanceName() == sigName) {
+            if (inst->getInstanceNameView() == sigName) {
               return inst;
             }
           }
@@ -999,7 +999,8 @@ bool NetlistElaboration::high_conn_(ModuleInstance* instance) {
                 ref->VpiParent(p);
                 ref->VpiName(sigName);
                 if (parent) {
-                  ref->VpiFullName(parent->getFullPathName() + "." + sigName);
+                  ref->VpiFullName(
+                      StrCat(parent->getFullPathNameView(), ".", sigName));
                   ref->Actual_group(net);
                 }
               }
@@ -1057,7 +1058,8 @@ bool NetlistElaboration::high_conn_(ModuleInstance* instance) {
             ref->VpiName(sigName);
             ref->VpiParent(p);
             if (parent) {
-              ref->VpiFullName(parent->getFullPathName() + "." + sigName);
+              ref->VpiFullName(
+                  StrCat(parent->getFullPathNameView(), ".", sigName));
               if (any* net =
                       bind_net_(fC, sigId, parent,
                                 instance->getInstanceBinding(), sigName)) {
@@ -1329,7 +1331,8 @@ bool NetlistElaboration::high_conn_(ModuleInstance* instance) {
           fC->populateCoreMembers(sigId, sigId, ref);
           ref->VpiName(sigName);
           if (parent) {
-            ref->VpiFullName(parent->getFullPathName() + "." + sigName);
+            ref->VpiFullName(
+                StrCat(parent->getFullPathNameView(), ".", sigName));
             ref->VpiParent(p);
             p->High_conn(ref);
             ref->Actual_group(net);
@@ -1370,7 +1373,7 @@ bool NetlistElaboration::high_conn_(ModuleInstance* instance) {
             ((ref_obj*)hexpr)->Actual_group(net);
             if (parent) {
               ((ref_obj*)hexpr)
-                  ->VpiFullName(StrCat(parent->getFullPathName(), ".",
+                  ->VpiFullName(StrCat(parent->getFullPathNameView(), ".",
                                        ((ref_obj*)hexpr)->VpiName()));
             }
           }
@@ -1518,7 +1521,7 @@ bool NetlistElaboration::high_conn_(ModuleInstance* instance) {
               ref->VpiParent(pp);
               if (parent) {
                 ref->VpiFullName(
-                    StrCat(parent->getFullPathName(), ".", sigName));
+                    StrCat(parent->getFullPathNameView(), ".", sigName));
                 pp->High_conn(ref);
                 if (UHDM::any* net =
                         bind_net_(fC, InvalidNodeId, parent,
@@ -1668,7 +1671,7 @@ interface_inst* NetlistElaboration::elab_interface_(
       if (net && (net->UhdmType() == uhdminterface_inst)) {
         ref_obj* n = s.MakeRef_obj();
         n->VpiName(sigName);
-        n->VpiFullName(StrCat(instance->getFullPathName(), ".", sigName));
+        n->VpiFullName(StrCat(instance->getFullPathNameView(), ".", sigName));
         fC->populateCoreMembers(nodeId, nodeId, n);
         if (sigName != instName)  // prevent loop in listener
           n->Actual_group(net);
@@ -1756,7 +1759,7 @@ bool NetlistElaboration::elab_generates_(ModuleInstance* instance) {
       gen_scope_array->Gen_scopes(vec);
       fC->populateCoreMembers(mm->getGenBlockId(), mm->getGenBlockId(),
                               gen_scope);
-      gen_scope->VpiName(instance->getInstanceName());
+      gen_scope->VpiName(instance->getInstanceNameView());
       fC->populateCoreMembers(mm->getGenBlockId(), mm->getGenBlockId(),
                               gen_scope_array);
       gen_scopes->push_back(gen_scope_array);
@@ -2572,7 +2575,7 @@ bool NetlistElaboration::elab_ports_nets_(
           portInterf.emplace(sig->getName());
           ref_obj* ref = s.MakeRef_obj();
           ref->VpiFullName(
-              StrCat(instance->getFullPathName(), ".", sig->getName()));
+              StrCat(instance->getFullPathNameView(), ".", sig->getName()));
           fC->populateCoreMembers(sig->getNodeId(), sig->getNodeId(), ref);
           ref->VpiParent(dest_port);
           dest_port->Low_conn(ref);
@@ -2658,7 +2661,7 @@ bool NetlistElaboration::elab_ports_nets_(
           portInterf.emplace(sig->getName());
           ref_obj* ref = s.MakeRef_obj();
           ref->VpiFullName(
-              StrCat(instance->getFullPathName(), ".", sig->getName()));
+              StrCat(instance->getFullPathNameView(), ".", sig->getName()));
           fC->populateCoreMembers(sig->getNodeId(), sig->getNodeId(), ref);
           dest_port->Low_conn(ref);
           Netlist::InstanceMap::iterator itr =
@@ -2756,8 +2759,8 @@ bool NetlistElaboration::elab_ports_nets_(
             }
             ref_obj* ref = s.MakeRef_obj();
             ref->VpiName(signame);
-            ref->VpiFullName(netlist->getParent()->getFullPathName() + "." +
-                             signame);
+            ref->VpiFullName(StrCat(netlist->getParent()->getFullPathNameView(),
+                                    ".", signame));
             fC->populateCoreMembers(sig->getNodeId(), sig->getNodeId(), ref);
             ref->Actual_group(n);
             ref->VpiParent(dest_port);
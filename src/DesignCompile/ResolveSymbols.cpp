@@ -78,13 +78,13 @@ void ResolveSymbols::createFastLookup() {
   // std::string fileName =  "FILE: " + m_fileData->getFileName() + " " +
   // m_fileData->getChunkFileName () + "\n"; std::cout << fileName;
 
-  VObjectTypeUnorderedSet types = {
+  static constexpr VObjectTypeBitSet types = {
       VObjectType::paModule_declaration,    VObjectType::paPackage_declaration,
       VObjectType::paConfig_declaration,    VObjectType::paUdp_declaration,
       VObjectType::paInterface_declaration, VObjectType::paProgram_declaration,
       VObjectType::paClass_declaration};
 
-  VObjectTypeUnorderedSet stopPoints = {
+  static constexpr VObjectTypeBitSet stopPoints = {
       VObjectType::paModule_declaration, VObjectType::paPackage_declaration,
       VObjectType::paProgram_declaration, VObjectType::paClass_declaration};
 
@@ -111,7 +111,8 @@ void ResolveSymbols::createFastLookup() {
           m_fileData->populateCoreMembers(object, object, pack);
           m_fileData->addPackageDefinition(pkgname, pdef);
 
-          VObjectTypeUnorderedSet subtypes = {VObjectType::paClass_declaration};
+          static constexpr VObjectTypeBitSet subtypes = {
+              VObjectType::paClass_declaration};
           std::vector<NodeId> subobjects =
               m_fileData->sl_collect_all(object, subtypes, subtypes);
           for (auto subobject : subobjects) {
@@ -137,7 +138,8 @@ void ResolveSymbols::createFastLookup() {
           Program* mdef = new Program(fullName, lib, m_fileData, object);
           m_fileData->addProgramDefinition(fullName, mdef);
 
-          VObjectTypeUnorderedSet subtypes = {VObjectType::paClass_declaration};
+          static constexpr VObjectTypeBitSet subtypes = {
+              VObjectType::paClass_declaration};
           std::vector<NodeId> subobjects =
               m_fileData->sl_collect_all(object, subtypes, subtypes);
           for (auto subobject : subobjects) {
@@ -170,7 +172,7 @@ void ResolveSymbols::createFastLookup() {
               new ModuleDefinition(m_fileData, object, fullName);
           m_fileData->addModuleDefinition(fullName, mdef);
 
-          VObjectTypeUnorderedSet subtypes = {
+          static constexpr VObjectTypeBitSet subtypes = {
               VObjectType::paClass_declaration,
               VObjectType::paModule_declaration};
           std::vector<NodeId> subobjects =
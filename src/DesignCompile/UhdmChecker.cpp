@@ -45,6 +45,7 @@
 #include <uhdm/uhdm.h>
 #include <uhdm/vpi_visitor.h>
 
+#include <atomic>
 #include <cstdint>
 #include <iomanip>
 #include <set>
@@ -52,6 +53,9 @@
 #include <stack>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace SURELOG {
@@ -67,8 +71,34 @@ using UHDM::uhdmunsupported_typespec;
 // implemented, the data collection part is. The actual coverage is not and is
 // commented out as it is a work in progress
 
+// Runs "job" on the indexes [0, count) over up to "threadCount" threads.
+template <typename Job>
+static void runParallel(size_t count, uint32_t threadCount, const Job& job) {
+  if (threadCount > count) threadCount = (uint32_t)count;
+  if (threadCount <= 1) {
+    for (size_t i = 0; i < count; ++i) job(i);
+    return;
+  }
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> threads;
+  threads.reserve(threadCount);
+  for (uint32_t t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&next, count, &job] {
+      for (size_t i = next++; i < count; i = next++) job(i);
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+}
+
+uint32_t UhdmChecker::getThreadCount() const {
+  return m_compileDesign->getCompiler()
+      ->getCommandLineParser()
+      ->getNbMaxTreads();
+}
+
 bool UhdmChecker::registerFile(const FileContent* fC,
-                               std::set<std::string_view>& moduleNames) {
+                               const std::set<std::string_view>& moduleNames,
+                               RangesMap& uhdmCover) const {
   const VObject& current = fC->Object(NodeId(fC->getSize() - 2));
   NodeId id = current.m_child;
   PathId fileId = fC->getFileId();
@@ -77,13 +107,6 @@ bool UhdmChecker::registerFile(const FileContent* fC,
   std::stack<NodeId> stack;
   stack.push(id);
 
-  FileNodeCoverMap::iterator fileItr = fileNodeCoverMap.find(fC);
-  if (fileItr == fileNodeCoverMap.end()) {
-    RangesMap uhdmCover;
-    fileNodeCoverMap.emplace(fC, uhdmCover);
-    fileItr = fileNodeCoverMap.find(fC);
-  }
-  RangesMap& uhdmCover = (*fileItr).second;
   bool skipModule = false;
   NodeId endModuleNode;
   while (!stack.empty()) {
@@ -257,6 +280,155 @@ bool UhdmChecker::registerFile(const FileContent* fC,
   return true;
 }
 
+void UhdmChecker::reportFileHtml(const FileContent* fC,
+                                 const RangesMap& uhdmCover, PathId chkFileId,
+                                 FileReport& result) const {
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  SymbolTable* symbols = m_compileDesign->getCompiler()->getSymbolTable();
+  std::vector<std::string> fileContentLines;
+  if (!fileSystem->readLines(fC->getFileId(), fileContentLines)) {
+    return;
+  }
+  const std::string filepath(fileSystem->toPath(fC->getFileId()));
+  const std::string fname(std::get<1>(fileSystem->getLeaf(chkFileId, symbols)));
+  std::ostream& reportF = fileSystem->openForWrite(chkFileId);
+  if (reportF.bad()) {
+    fileSystem->close(reportF);
+    return;
+  }
+  reportF << "\n<!DOCTYPE html>\n<html>\n<head>\n<style>\nbody {\n\n}\np "
+             "{\nfont-size: 14px;\n}</style>\n";
+
+  float cov = 0.0f;
+  const auto& itr = fileCoverageMap.find(fC->getFileId());
+  cov = (*itr).second;
+  std::stringstream strst;
+  strst << std::setprecision(3) << cov;
+
+  const std::string coverage = StrCat(" Cov: ", strst.str(), "% ");
+  const std::string fileStatGreen = StrCat(
+      "<div style=\"overflow: hidden;\"> <h3 style=\"background-color: "
+      "#82E0AA; margin:0; min-width: 110px; padding:10; float: left; \">",
+      coverage,
+      "</h3> <h3 style=\"margin:0; padding:10; float: left; \"> <a href=",
+      fname + "> ", filepath, "</a></h3></div>\n");
+  const std::string fileStatPink = StrCat(
+      "<div style=\"overflow: hidden;\"> <h3 style=\"background-color: "
+      "#FFB6C1; margin:0; min-width: 110px; padding:10; float: left; \">",
+      coverage,
+      "</h3> <h3 style=\"margin:0; padding:10; float: left; \"> <a href=",
+      fname + "> ", filepath, "</a></h3></div>\n");
+  const std::string fileStatRed = StrCat(
+      "<div style=\"overflow: hidden;\"> <h3 style=\"background-color: "
+      "#FF0000; margin:0; min-width: 110px; padding:10; float: left; \">",
+      coverage,
+      "</h3> <h3 style=\"margin:0; padding:10; float: left; \"> <a href=",
+      fname + "> ", filepath, "</a></h3></div>\n");
+  const std::string fileStatWhite =
+      StrCat("<h3 style=\"margin:0; padding:0 \"> <a href=" + fname + ">",
+             filepath, "</a> ", coverage, "</h3>\n");
+
+  std::string& allUncovered = result.m_uncovered;
+  reportF << "<h3>" << filepath << coverage << "</h3>\n";
+  bool uncovered = false;
+  std::string pinkCoverage;
+  std::string redCoverage;
+  int32_t line = 0;
+  for (const auto& lineText : fileContentLines) {
+    ++line;
+    RangesMap::const_iterator cItr = uhdmCover.find(line);
+
+    if (cItr == uhdmCover.end()) {
+      reportF << "<pre style=\"margin:0; padding:0 \">" << std::setw(4) << line
+              << ": " << lineText << "</pre>\n";  // white
+    } else {
+      const Ranges& ranges = (*cItr).second;
+      bool covered = false;
+      bool exist = false;
+      bool unsupported = false;
+      for (const ColRange& crange : ranges) {
+        switch (crange.covered) {
+          case EXIST:
+            exist = true;
+            break;
+          case COVERED:
+            covered = true;
+            break;
+          case UNSUPPORTED:
+            unsupported = true;
+            break;
+        }
+      }
+
+      if (lineText.empty()) result.m_emptyLines.emplace_back(line);
+      if (exist && covered && (!unsupported)) {
+        // reportF << "<pre style=\"background-color: #FFFFE0; margin:0;
+        // padding:0; display: inline-block\">" << std::setw (4) <<
+        // std::to_string(line) << ": " << "</pre> <pre
+        // style=\"background-color: #C0C0C0; margin:0; padding:0; display:
+        // inline-block \">" << lineText << "</pre>\n";  // grey
+        reportF << "<pre style=\"background-color: #C0C0C0; margin:0; "
+                   "padding:0 \">"
+                << std::setw(4) << std::to_string(line) << ": " << lineText
+                << "</pre>\n";  // grey
+      } else if (exist && (!unsupported)) {
+        reportF
+            << "<pre id=\"id" << line
+            << R"(" style="background-color: #FFB6C1; margin:0; padding:0 ">)"
+            << std::setw(4) << std::to_string(line) << ": " << lineText
+            << "</pre>\n";  // pink
+        if (uncovered == false) {
+          StrAppend(&allUncovered, "<pre></pre>\n");
+          StrAppend(&allUncovered, fileStatWhite);
+          StrAppend(&allUncovered, "<pre></pre>\n");
+          uncovered = true;
+        }
+        pinkCoverage = fileStatPink;
+        StrAppend(
+            &allUncovered,
+            "<pre style=\"background-color: #FFB6C1; margin:0; padding:0 \"> "
+            "<a href=",
+            fname, "#id", line, ">", lineText, "</a></pre>\n");
+      } else if (unsupported) {
+        reportF
+            << "<pre id=\"id" << line
+            << R"(" style="background-color: #FF0000; margin:0; padding:0 ">)"
+            << std::setw(4) << std::to_string(line) << ": " << lineText
+            << "</pre>\n";  // red
+        if (uncovered == false) {
+          StrAppend(&allUncovered, "<pre></pre>\n");
+          StrAppend(&allUncovered, fileStatWhite);
+          StrAppend(&allUncovered, "<pre></pre>\n");
+          uncovered = true;
+        }
+        redCoverage = fileStatRed;
+        StrAppend(
+            &allUncovered,
+            "<pre style=\"background-color: #FF0000; margin:0; padding:0 \"> "
+            "<a href=",
+            fname, "#id", line, ">", lineText, "</a></pre>\n");
+      } else {
+        reportF << "<pre style=\"background-color: #C0C0C0; margin:0; "
+                   "padding:0 \">"
+                << std::setw(4) << std::to_string(line) << ": " << lineText
+                << "</pre>\n";  // grey
+      }
+    }
+  }
+  result.m_coverage = static_cast<int32_t>(cov);
+  if (!redCoverage.empty()) {
+    result.m_status = redCoverage;
+  } else if (!pinkCoverage.empty()) {
+    result.m_status = pinkCoverage;
+  }
+  if (uncovered == false) {
+    result.m_status = fileStatGreen;
+  }
+  reportF << "</body>\n</html>\n";
+  fileSystem->close(reportF);
+  result.m_written = true;
+}
+
 bool UhdmChecker::reportHtml(PathId uhdmFileId, float overallCoverage) {
   FileSystem* const fileSystem = FileSystem::getInstance();
   ErrorContainer* errors = m_compileDesign->getCompiler()->getErrorContainer();
@@ -275,161 +447,43 @@ bool UhdmChecker::reportHtml(PathId uhdmFileId, float overallCoverage) {
   report << "<h2 style=\"text-decoration: underline\">"
          << "Overall Coverage: " << std::setprecision(3) << overallCoverage
          << "%</h2>\n";
+
+  // The pages of the files are independent, only their summaries are merged,
+  // in file order.
+  std::vector<std::pair<const FileContent*, const RangesMap*>> files;
+  std::vector<PathId> chkFileIds;
+  files.reserve(fileNodeCoverMap.size());
+  chkFileIds.reserve(fileNodeCoverMap.size());
   uint32_t fileIndex = 1;
+  for (const auto& [fC, uhdmCover] : fileNodeCoverMap) {
+    files.emplace_back(fC, &uhdmCover);
+    chkFileIds.emplace_back(
+        fileSystem->getCheckerHtmlFile(uhdmFileId, fileIndex++, symbols));
+  }
+  std::vector<FileReport> fileReports(files.size());
+  runParallel(files.size(), getThreadCount(), [&](size_t index) {
+    reportFileHtml(files[index].first, *files[index].second, chkFileIds[index],
+                   fileReports[index]);
+  });
+
   std::string allUncovered;
   static std::multimap<int32_t, std::string> orderedCoverageMap;
-  for (const auto& [fC, uhdmCover] : fileNodeCoverMap) {
-    std::vector<std::string> fileContentLines;
-    if (!fileSystem->readLines(fC->getFileId(), fileContentLines)) {
-      fileSystem->close(report);
-      return false;
+  for (size_t index = 0, n = files.size(); index < n; ++index) {
+    const FileReport& fileReport = fileReports[index];
+    for (int32_t line : fileReport.m_emptyLines) {
+      Location loc(files[index].first->getFileId(), line, 1);
+      Error err(ErrorDefinition::UHDM_WRONG_COVERAGE_LINE, loc);
+      errors->addError(err);
     }
-    const std::string filepath(fileSystem->toPath(fC->getFileId()));
-    const PathId chkFileId =
-        fileSystem->getCheckerHtmlFile(uhdmFileId, fileIndex, symbols);
-    const std::string fname(
-        std::get<1>(fileSystem->getLeaf(chkFileId, symbols)));
-    std::ostream& reportF = fileSystem->openForWrite(chkFileId);
-    if (reportF.bad()) {
+    if (!fileReport.m_written) {
+      // Stops at the first page that could not be written
       fileSystem->close(report);
-      fileSystem->close(reportF);
       return false;
     }
-    reportF << "\n<!DOCTYPE html>\n<html>\n<head>\n<style>\nbody {\n\n}\np "
-               "{\nfont-size: 14px;\n}</style>\n";
-
-    float cov = 0.0f;
-    const auto& itr = fileCoverageMap.find(fC->getFileId());
-    cov = (*itr).second;
-    std::stringstream strst;
-    strst << std::setprecision(3) << cov;
-
-    const std::string coverage = StrCat(" Cov: ", strst.str(), "% ");
-    const std::string fileStatGreen = StrCat(
-        "<div style=\"overflow: hidden;\"> <h3 style=\"background-color: "
-        "#82E0AA; margin:0; min-width: 110px; padding:10; float: left; \">",
-        coverage,
-        "</h3> <h3 style=\"margin:0; padding:10; float: left; \"> <a href=",
-        fname + "> ", filepath, "</a></h3></div>\n");
-    const std::string fileStatPink = StrCat(
-        "<div style=\"overflow: hidden;\"> <h3 style=\"background-color: "
-        "#FFB6C1; margin:0; min-width: 110px; padding:10; float: left; \">",
-        coverage,
-        "</h3> <h3 style=\"margin:0; padding:10; float: left; \"> <a href=",
-        fname + "> ", filepath, "</a></h3></div>\n");
-    const std::string fileStatRed = StrCat(
-        "<div style=\"overflow: hidden;\"> <h3 style=\"background-color: "
-        "#FF0000; margin:0; min-width: 110px; padding:10; float: left; \">",
-        coverage,
-        "</h3> <h3 style=\"margin:0; padding:10; float: left; \"> <a href=",
-        fname + "> ", filepath, "</a></h3></div>\n");
-    const std::string fileStatWhite =
-        StrCat("<h3 style=\"margin:0; padding:0 \"> <a href=" + fname + ">",
-               filepath, "</a> ", coverage, "</h3>\n");
-
-    reportF << "<h3>" << filepath << coverage << "</h3>\n";
-    bool uncovered = false;
-    std::string pinkCoverage;
-    std::string redCoverage;
-    int32_t line = 0;
-    for (const auto& lineText : fileContentLines) {
-      ++line;
-      RangesMap::const_iterator cItr = uhdmCover.find(line);
-
-      if (cItr == uhdmCover.end()) {
-        reportF << "<pre style=\"margin:0; padding:0 \">" << std::setw(4)
-                << line << ": " << lineText << "</pre>\n";  // white
-      } else {
-        const Ranges& ranges = (*cItr).second;
-        bool covered = false;
-        bool exist = false;
-        bool unsupported = false;
-        for (const ColRange& crange : ranges) {
-          switch (crange.covered) {
-            case EXIST:
-              exist = true;
-              break;
-            case COVERED:
-              covered = true;
-              break;
-            case UNSUPPORTED:
-              unsupported = true;
-              break;
-          }
-        }
-
-        if (lineText.empty()) {
-          Location loc(fC->getFileId(), line, 1);
-          Error err(ErrorDefinition::UHDM_WRONG_COVERAGE_LINE, loc);
-          errors->addError(err);
-        }
-        if (exist && covered && (!unsupported)) {
-          // reportF << "<pre style=\"background-color: #FFFFE0; margin:0;
-          // padding:0; display: inline-block\">" << std::setw (4) <<
-          // std::to_string(line) << ": " << "</pre> <pre
-          // style=\"background-color: #C0C0C0; margin:0; padding:0; display:
-          // inline-block \">" << lineText << "</pre>\n";  // grey
-          reportF << "<pre style=\"background-color: #C0C0C0; margin:0; "
-                     "padding:0 \">"
-                  << std::setw(4) << std::to_string(line) << ": " << lineText
-                  << "</pre>\n";  // grey
-        } else if (exist && (!unsupported)) {
-          reportF
-              << "<pre id=\"id" << line
-              << R"(" style="background-color: #FFB6C1; margin:0; padding:0 ">)"
-              << std::setw(4) << std::to_string(line) << ": " << lineText
-              << "</pre>\n";  // pink
-          if (uncovered == false) {
-            StrAppend(&allUncovered, "<pre></pre>\n");
-            StrAppend(&allUncovered, fileStatWhite);
-            StrAppend(&allUncovered, "<pre></pre>\n");
-            uncovered = true;
-          }
-          pinkCoverage = fileStatPink;
-          StrAppend(
-              &allUncovered,
-              "<pre style=\"background-color: #FFB6C1; margin:0; padding:0 \"> "
-              "<a href=",
-              fname, "#id", line, ">", lineText, "</a></pre>\n");
-        } else if (unsupported) {
-          reportF
-              << "<pre id=\"id" << line
-              << R"(" style="background-color: #FF0000; margin:0; padding:0 ">)"
-              << std::setw(4) << std::to_string(line) << ": " << lineText
-              << "</pre>\n";  // red
-          if (uncovered == false) {
-            StrAppend(&allUncovered, "<pre></pre>\n");
-            StrAppend(&allUncovered, fileStatWhite);
-            StrAppend(&allUncovered, "<pre></pre>\n");
-            uncovered = true;
-          }
-          redCoverage = fileStatRed;
-          StrAppend(
-              &allUncovered,
-              "<pre style=\"background-color: #FF0000; margin:0; padding:0 \"> "
-              "<a href=",
-              fname, "#id", line, ">", lineText, "</a></pre>\n");
-        } else {
-          reportF << "<pre style=\"background-color: #C0C0C0; margin:0; "
-                     "padding:0 \">"
-                  << std::setw(4) << std::to_string(line) << ": " << lineText
-                  << "</pre>\n";  // grey
-        }
-      }
-    }
-    if (!redCoverage.empty()) {
-      orderedCoverageMap.emplace(static_cast<int32_t>(cov), redCoverage);
-    } else {
-      if (!pinkCoverage.empty()) {
-        orderedCoverageMap.emplace(static_cast<int32_t>(cov), pinkCoverage);
-      }
-    }
-    if (uncovered == false) {
-      orderedCoverageMap.emplace(static_cast<int32_t>(cov), fileStatGreen);
+    if (!fileReport.m_status.empty()) {
+      orderedCoverageMap.emplace(fileReport.m_coverage, fileReport.m_status);
     }
-    reportF << "</body>\n</html>\n";
-    fileSystem->close(reportF);
-    fileIndex++;
+    StrAppend(&allUncovered, fileReport.m_uncovered);
   }
   for (const auto& covFile : orderedCoverageMap) {
     report << covFile.second << "\n";
@@ -444,20 +498,17 @@ bool UhdmChecker::reportHtml(PathId uhdmFileId, float overallCoverage) {
   return true;
 }
 
-void UhdmChecker::mergeColumnCoverage() {
-  for (auto& fileItr : fileNodeCoverMap) {
-    RangesMap& uhdmCover = fileItr.second;
-    for (auto& cItr : uhdmCover) {
-      Ranges& ranges = cItr.second;
-      Ranges merged;
-      for (const ColRange& crange : ranges) {
-        if (crange.from >= crange.to) {
-        } else {
-          merged.push_back(crange);
-        }
+void UhdmChecker::mergeColumnCoverage(RangesMap& uhdmCover) {
+  for (auto& cItr : uhdmCover) {
+    Ranges& ranges = cItr.second;
+    Ranges merged;
+    for (const ColRange& crange : ranges) {
+      if (crange.from >= crange.to) {
+      } else {
+        merged.push_back(crange);
       }
-      cItr.second = merged;
     }
+    cItr.second = merged;
   }
 }
 
@@ -547,87 +598,116 @@ float UhdmChecker::reportCoverage(PathId uhdmFileId) {
 void UhdmChecker::annotate() {
   FileSystem* const fileSystem = FileSystem::getInstance();
   Serializer& s = m_compileDesign->getSerializer();
+  // Sorts the objects per file, in model order, resolving each file name once.
+  // The names spelling a same file share its work item, so that no two jobs
+  // annotate the same ranges.
+  struct ObjectLine final {
+    uint32_t m_line;
+    bool m_unsupported;
+  };
+  std::vector<RangesMap*> covers;
+  std::vector<std::vector<ObjectLine>> objectLines;
+  std::unordered_map<std::string_view, int32_t> fileIndexes;
+  std::unordered_map<const FileContent*, int32_t> contentIndexes;
   const auto& objects = s.AllObjects();
   for (const auto& obj : objects) {
     const BaseClass* bc = obj.first;
     if (!bc) continue;
-    bool unsupported = false;
+    auto [indexItr, inserted] = fileIndexes.emplace(bc->VpiFile(), -1);
+    if (inserted) {
+      PathId fnId = fileSystem->toPathId(
+          bc->VpiFile(), m_compileDesign->getCompiler()->getSymbolTable());
+      const auto& fItr = fileMap.find(fnId);
+      if (fItr != fileMap.end()) {
+        const FileContent* fC = (*fItr).second;
+        FileNodeCoverMap::iterator fileItr = fileNodeCoverMap.find(fC);
+        if (fileItr != fileNodeCoverMap.end()) {
+          auto [contentItr, newContent] =
+              contentIndexes.emplace(fC, (int32_t)covers.size());
+          if (newContent) {
+            covers.emplace_back(&fileItr->second);
+            objectLines.emplace_back();
+          }
+          indexItr->second = contentItr->second;
+        }
+      }
+    }
+    if (indexItr->second < 0) continue;
     UHDM_OBJECT_TYPE ot = bc->UhdmType();
-    if ((ot == uhdmunsupported_expr) || (ot == uhdmunsupported_stmt) ||
-        (ot == uhdmunsupported_typespec))
-      unsupported = true;
-    PathId fnId = fileSystem->toPathId(
-        bc->VpiFile(), m_compileDesign->getCompiler()->getSymbolTable());
-    const auto& fItr = fileMap.find(fnId);
-    if (fItr != fileMap.end()) {
-      const FileContent* fC = (*fItr).second;
-      FileNodeCoverMap::iterator fileItr = fileNodeCoverMap.find(fC);
-      if (fileItr != fileNodeCoverMap.end()) {
-        RangesMap& uhdmCover = (*fileItr).second;
-        RangesMap::iterator cItr = uhdmCover.find(bc->VpiLineNo());
-        // uint16_t from = bc->VpiColumnNo();
-        // uint16_t to = bc->VpiEndColumnNo();
-
-        if (cItr != uhdmCover.end()) {
-          // bool found = false;
-
-          for (ColRange& crange : (*cItr).second) {
-            //  if ((crange.from >= from) && (crange.to <= to)) {
-            //    found = true;
-            //    crange.from = from;
-            //    crange.to = to;
-            if (unsupported)
-              crange.covered = Status::UNSUPPORTED;
-            else
-              crange.covered = Status::COVERED;
-            /*    } else if ((crange.from <= from) && (crange.to >= to)) {
-                  if (crange.from < from) {
-                    ColRange crange1;
-                    crange1.from = crange.from;
-                    crange1.to = from;
-                    crange1.covered = Status::EXIST;
-                    (*cItr).second.push_back(crange1);
-                  }
-                  if (crange.to > to) {
-                    ColRange crange1;
-                    crange1.from = to;
-                    crange1.to = crange.to;
-                    crange1.covered = Status::EXIST;
-                    (*cItr).second.push_back(crange1);
-                  }
-                  found = true;
-                  crange.from = from;
-                  crange.to = to;
-                  if (unsupported)
-                    crange.covered = Status::UNSUPPORTED;
-                  else
-                    crange.covered = Status::COVERED;
-                } else if ((from < crange.from) && (to > crange.from) && (to <
-               crange.to)) { crange.from = to; ColRange crange1; crange1.from =
-               from; crange1.to = to; crange1.covered = Status::COVERED;
+    const bool unsupported = (ot == uhdmunsupported_expr) ||
+                             (ot == uhdmunsupported_stmt) ||
+                             (ot == uhdmunsupported_typespec);
+    objectLines[indexItr->second].push_back({bc->VpiLineNo(), unsupported});
+  }
+
+  // The files are then annotated independently
+  runParallel(covers.size(), getThreadCount(), [&](size_t index) {
+    RangesMap& uhdmCover = *covers[index];
+    for (const ObjectLine& objectLine : objectLines[index]) {
+      const bool unsupported = objectLine.m_unsupported;
+      RangesMap::iterator cItr = uhdmCover.find(objectLine.m_line);
+      // uint16_t from = bc->VpiColumnNo();
+      // uint16_t to = bc->VpiEndColumnNo();
+
+      if (cItr != uhdmCover.end()) {
+        // bool found = false;
+
+        for (ColRange& crange : (*cItr).second) {
+          //  if ((crange.from >= from) && (crange.to <= to)) {
+          //    found = true;
+          //    crange.from = from;
+          //    crange.to = to;
+          if (unsupported)
+            crange.covered = Status::UNSUPPORTED;
+          else
+            crange.covered = Status::COVERED;
+          /*    } else if ((crange.from <= from) && (crange.to >= to)) {
+                if (crange.from < from) {
+                  ColRange crange1;
+                  crange1.from = crange.from;
+                  crange1.to = from;
+                  crange1.covered = Status::EXIST;
                   (*cItr).second.push_back(crange1);
-                } else if ((from < crange.to) && (from > crange.from) && (to >
-               crange.to)) { crange.to = from; ColRange crange1; crange1.from =
-               from; crange1.to = to; crange1.covered = Status::COVERED;
+                }
+                if (crange.to > to) {
+                  ColRange crange1;
+                  crange1.from = to;
+                  crange1.to = crange.to;
+                  crange1.covered = Status::EXIST;
                   (*cItr).second.push_back(crange1);
-                } */
-          }
-          /*
-                    if (found == false) {
-                      ColRange crange;
-                      crange.from = from;
-                      crange.to = to;
-                      if (unsupported)
-                        crange.covered = Status::UNSUPPORTED;
-                      else
-                        crange.covered = Status::COVERED;
-                      (*cItr).second.push_back(crange);
-                    }
-          */
+                }
+                found = true;
+                crange.from = from;
+                crange.to = to;
+                if (unsupported)
+                  crange.covered = Status::UNSUPPORTED;
+                else
+                  crange.covered = Status::COVERED;
+              } else if ((from < crange.from) && (to > crange.from) && (to <
+             crange.to)) { crange.from = to; ColRange crange1; crange1.from =
+             from; crange1.to = to; crange1.covered = Status::COVERED;
+                (*cItr).second.push_back(crange1);
+              } else if ((from < crange.to) && (from > crange.from) && (to >
+             crange.to)) { crange.to = from; ColRange crange1; crange1.from =
+             from; crange1.to = to; crange1.covered = Status::COVERED;
+                (*cItr).second.push_back(crange1);
+              } */
         }
+        /*
+                  if (found == false) {
+                    ColRange crange;
+                    crange.from = from;
+                    crange.to = to;
+                    if (unsupported)
+                      crange.covered = Status::UNSUPPORTED;
+                    else
+                      crange.covered = Status::COVERED;
+                    (*cItr).second.push_back(crange);
+                  }
+        */
       }
     }
-  }
+  });
 }
 
 void collectUsedFileContents(std::set<const FileContent*>& files,
@@ -665,6 +745,8 @@ bool UhdmChecker::check(PathId uhdmFileId) {
     }
   }
 
+  // The files are registered independently, in parallel
+  std::vector<std::pair<const FileContent*, RangesMap*>> registered;
   for (const FileContent* fC : files) {
     if (!clp->createCache()) {
       std::string_view fileName = std::get<1>(
@@ -674,13 +756,30 @@ bool UhdmChecker::check(PathId uhdmFileId) {
       }
     }
     fileMap.emplace(fC->getFileId(), fC);
-    registerFile(fC, moduleNames);
+    registered.emplace_back(fC, &fileNodeCoverMap[fC]);
+  }
+  const uint32_t threadCount = getThreadCount();
+  std::vector<char> hasContent(registered.size(), false);
+  runParallel(registered.size(), threadCount, [&](size_t index) {
+    hasContent[index] = registerFile(registered[index].first, moduleNames,
+                                     *registered[index].second);
+  });
+  for (size_t index = 0, n = registered.size(); index < n; ++index) {
+    if (!hasContent[index]) fileNodeCoverMap.erase(registered[index].first);
   }
 
-  // Annotate UHDM object coverage
+  // Annotate UHDM object coverage, the save may garbage collect the model
+  m_compileDesign->waitForUhdmSave();
   annotate();
 
-  mergeColumnCoverage();
+  std::vector<RangesMap*> covers;
+  covers.reserve(fileNodeCoverMap.size());
+  for (auto& [fC, uhdmCover] : fileNodeCoverMap) {
+    covers.emplace_back(&uhdmCover);
+  }
+  runParallel(covers.size(), threadCount, [&covers](size_t index) {
+    mergeColumnCoverage(*covers[index]);
+  });
 
   if (!fileSystem->mkdirs(
           fileSystem->getCheckerDir(clp->fileunit(), symbols))) {
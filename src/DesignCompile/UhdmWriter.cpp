@@ -67,6 +67,7 @@
 #include "Surelog/Testbench/TypeDef.h"
 #include "Surelog/Testbench/Variable.h"
 #include "Surelog/Utils/StringUtils.h"
+#include "Surelog/Utils/Timer.h"
 
 // UHDM
 #include <uhdm/ElaboratorListener.h>
@@ -4373,9 +4374,9 @@ void UhdmWriter::writeInstance(ModuleDefinition* mod, ModuleInstance* instance,
                 childDef->getFileContents()[0]->getFileId())) {
           sm->VpiCellInstance(true);
         }
-        sm->VpiName(child->getInstanceName());
+        sm->VpiName(child->getInstanceNameView());
         sm->VpiDefName(child->getModuleName());
-        sm->VpiFullName(child->getFullPathName());
+        sm->VpiFullName(child->getFullPathNameView());
         const FileContent* defFile = mm->getFileContents()[0];
         sm->VpiDefFile(fileSystem->toPath(defFile->getFileId()));
         sm->VpiDefLineNo(defFile->Line(mm->getNodeIds()[0]));
@@ -4417,8 +4418,8 @@ void UhdmWriter::writeInstance(ModuleDefinition* mod, ModuleInstance* instance,
         if (subGenScopeArrays == nullptr)
           subGenScopeArrays = s.MakeGen_scope_arrayVec();
         gen_scope_array* sm = s.MakeGen_scope_array();
-        sm->VpiName(child->getInstanceName());
-        sm->VpiFullName(child->getFullPathName());
+        sm->VpiName(child->getInstanceNameView());
+        sm->VpiFullName(child->getFullPathNameView());
         child->getFileContent()->populateCoreMembers(child->getNodeId(),
                                                      child->getNodeId(), sm);
         subGenScopeArrays->push_back(sm);
@@ -4445,9 +4446,9 @@ void UhdmWriter::writeInstance(ModuleDefinition* mod, ModuleInstance* instance,
       } else if (insttype == VObjectType::paInterface_instantiation) {
         if (subInterfaces == nullptr) subInterfaces = s.MakeInterface_instVec();
         interface_inst* sm = s.MakeInterface_inst();
-        sm->VpiName(child->getInstanceName());
+        sm->VpiName(child->getInstanceNameView());
         sm->VpiDefName(child->getModuleName());
-        sm->VpiFullName(child->getFullPathName());
+        sm->VpiFullName(child->getFullPathNameView());
         child->getFileContent()->populateCoreMembers(child->getNodeId(),
                                                      child->getNodeId(), sm);
         const FileContent* defFile = mm->getFileContents()[0];
@@ -4537,8 +4538,8 @@ void UhdmWriter::writeInstance(ModuleDefinition* mod, ModuleInstance* instance,
           gate = s.MakeGate();
           if (UHDM::VectorOfrange* ranges = child->getNetlist()->ranges()) {
             gate_array = s.MakeGate_array();
-            gate_array->VpiName(child->getInstanceName());
-            gate_array->VpiFullName(child->getFullPathName());
+            gate_array->VpiName(child->getInstanceNameView());
+            gate_array->VpiFullName(child->getFullPathNameView());
             child->getFileContent()->populateCoreMembers(
                 child->getNodeId(), child->getNodeId(), gate_array);
             VectorOfprimitive* prims = s.MakePrimitiveVec();
@@ -4563,9 +4564,9 @@ void UhdmWriter::writeInstance(ModuleDefinition* mod, ModuleInstance* instance,
           }
         }
 
-        gate->VpiName(child->getInstanceName());
+        gate->VpiName(child->getInstanceNameView());
         gate->VpiDefName(child->getModuleName());
-        gate->VpiFullName(child->getFullPathName());
+        gate->VpiFullName(child->getFullPathNameView());
         child->getFileContent()->populateCoreMembers(child->getNodeId(),
                                                      child->getNodeId(), gate);
         UHDM_OBJECT_TYPE utype = m->UhdmType();
@@ -4585,9 +4586,9 @@ void UhdmWriter::writeInstance(ModuleDefinition* mod, ModuleInstance* instance,
     } else if (Program* prog = valuedcomponenti_cast<Program*>(childDef)) {
       if (subPrograms == nullptr) subPrograms = s.MakeProgramVec();
       program* sm = s.MakeProgram();
-      sm->VpiName(child->getInstanceName());
+      sm->VpiName(child->getInstanceNameView());
       sm->VpiDefName(child->getModuleName());
-      sm->VpiFullName(child->getFullPathName());
+      sm->VpiFullName(child->getFullPathNameView());
       child->getFileContent()->populateCoreMembers(child->getNodeId(),
                                                    child->getNodeId(), sm);
       const FileContent* defFile = prog->getFileContents()[0];
@@ -4608,9 +4609,9 @@ void UhdmWriter::writeInstance(ModuleDefinition* mod, ModuleInstance* instance,
       // Undefined module
       if (subModules == nullptr) subModules = s.MakeModule_instVec();
       module_inst* sm = s.MakeModule_inst();
-      sm->VpiName(child->getInstanceName());
+      sm->VpiName(child->getInstanceNameView());
       sm->VpiDefName(child->getModuleName());
-      sm->VpiFullName(child->getFullPathName());
+      sm->VpiFullName(child->getFullPathNameView());
       child->getFileContent()->populateCoreMembers(child->getNodeId(),
                                                    child->getNodeId(), sm);
       subModules->push_back(sm);
@@ -5066,53 +5067,73 @@ vpiHandle UhdmWriter::write(PathId uhdmFileId) {
 
   m_helper.setElabMode(true);
 
+  CommandLineParser* const clp =
+      m_compileDesign->getCompiler()->getCommandLineParser();
+  // With -profile, each post-processing pass is timed
+  std::string passProfile;
+  Timer tmr;
+
   // ----------------------------------
   // Fully elaborated model
-  if (m_compileDesign->getCompiler()->getCommandLineParser()->getElabUhdm()) {
+  if (clp->getElabUhdm()) {
     Error err(ErrorDefinition::UHDM_ELABORATION, loc);
     m_compileDesign->getCompiler()->getErrorContainer()->addError(err);
     m_compileDesign->getCompiler()->getErrorContainer()->printMessages(
-        m_compileDesign->getCompiler()->getCommandLineParser()->muteStdout());
+        clp->muteStdout());
 
+    tmr.reset();
     if (ElaboratorContext* elaboratorContext =
             new ElaboratorContext(&s, false, false)) {
       elaboratorContext->m_elaborator.uniquifyTypespec(false);
       elaboratorContext->m_elaborator.listenDesigns(designs);
       delete elaboratorContext;
     }
+    if (clp->profile()) {
+      StrAppend(&passProfile, "UHDM elaboration took ",
+                StringUtils::to_string(tmr.elapsed()), "s\n");
+    }
 
-    if (m_compileDesign->getCompiler()
-            ->getCommandLineParser()
-            ->getUhdmStats()) {
+    if (clp->getUhdmStats()) {
       s.PrintStats(std::cerr, "Elaborated Model");
     }
 
+    tmr.reset();
     if (UhdmAdjuster* adjuster = new UhdmAdjuster(&s, d)) {
       adjuster->listenDesigns(designs);
       delete adjuster;
     }
+    if (clp->profile()) {
+      StrAppend(&passProfile, "UHDM adjuster took ",
+                StringUtils::to_string(tmr.elapsed()), "s\n");
+    }
   }
 
   // ----------------------------------
   // Lint only the elaborated model
+  tmr.reset();
   if (UhdmLint* linter = new UhdmLint(&s, d)) {
     linter->listenDesigns(designs);
     delete linter;
   }
+  if (clp->profile()) {
+    StrAppend(&passProfile, "UHDM lint took ",
+              StringUtils::to_string(tmr.elapsed()), "s\n");
+  }
 
-  if (m_compileDesign->getCompiler()
-          ->getCommandLineParser()
-          ->reportNonSynthesizable()) {
+  if (clp->reportNonSynthesizable()) {
+    tmr.reset();
     std::set<const any*> nonSynthesizableObjects;
     if (SynthSubset* annotate =
             new SynthSubset(&s, nonSynthesizableObjects, d, true,
-                            m_compileDesign->getCompiler()
-                                ->getCommandLineParser()
-                                ->reportNonSynthesizableWithFormal())) {
+                            clp->reportNonSynthesizableWithFormal())) {
       annotate->listenDesigns(designs);
       annotate->filterNonSynthesizable();
       delete annotate;
     }
+    if (clp->profile()) {
+      StrAppend(&passProfile, "UHDM synthesis subset took ",
+                StringUtils::to_string(tmr.elapsed()), "s\n");
+    }
   }
 
   // Purge obsolete typespecs
@@ -5121,6 +5142,7 @@ vpiHandle UhdmWriter::write(PathId uhdmFileId) {
     const typespec* tps = o.second;
     if (tps != orig) s.Erase(orig);
   }
+  m_compileDesign->addUhdmProfile(passProfile);
 
   const fs::path uhdmFile = fileSystem->toPlatformAbsPath(uhdmFileId);
   if (m_compileDesign->getCompiler()->getCommandLineParser()->writeUhdm()) {
@@ -5130,7 +5152,13 @@ vpiHandle UhdmWriter::write(PathId uhdmFileId) {
         m_compileDesign->getCompiler()->getCommandLineParser()->muteStdout());
     s.SetGCEnabled(
         m_compileDesign->getCompiler()->getCommandLineParser()->gc());
-    s.Save(uhdmFile);
+    if (clp->getDebugUhdm() || clp->getCoverUhdm()) {
+      // Overlaps with the coverage check below, which waits for it before
+      // reading the model
+      m_compileDesign->saveUhdmAsync(uhdmFileId);
+    } else {
+      m_compileDesign->saveUhdm(uhdmFileId);
+    }
   }
 
   if (m_compileDesign->getCompiler()->getCommandLineParser()->getDebugUhdm() ||
@@ -5151,6 +5179,7 @@ vpiHandle UhdmWriter::write(PathId uhdmFileId) {
 
   if (m_compileDesign->getCompiler()->getCommandLineParser()->getDebugUhdm()) {
     if (m_compileDesign->getCompiler()->getCommandLineParser()->writeUhdm()) {
+      m_compileDesign->waitForUhdmSave();
       Location loc((SymbolId)uhdmFileId);
       Error err1(ErrorDefinition::UHDM_LOAD_DB, loc);
       m_compileDesign->getCompiler()->getErrorContainer()->addError(err1);
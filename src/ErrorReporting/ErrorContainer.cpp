@@ -71,36 +71,117 @@ void ErrorContainer::init() {
   }
 }
 
-Error& ErrorContainer::addError(Error& error, bool showDuplicates,
-                                bool reentrantPython) {
-  std::tuple<std::string, bool, bool> textStatus =
-      createErrorMessage(error, reentrantPython);
-  if (std::get<2>(textStatus))  // filter Message
-    return error;
+bool ErrorContainer::isFiltered_(const Error& error) const {
+  if (error.m_reported || error.m_waived) return false;
+  const std::map<ErrorDefinition::ErrorType, ErrorDefinition::ErrorInfo>&
+      infoMap = ErrorDefinition::getErrorInfoMap();
+  std::map<ErrorDefinition::ErrorType,
+           ErrorDefinition::ErrorInfo>::const_iterator itr =
+      infoMap.find(error.m_errorId);
+  if (itr == infoMap.end()) return false;
+  switch ((*itr).second.m_severity) {
+    case ErrorDefinition::WARNING:
+      return m_clp->filterWarning();
+    case ErrorDefinition::INFO:
+      return m_clp->filterInfo() &&
+             (error.m_errorId != ErrorDefinition::PP_PROCESSING_SOURCE_FILE);
+    case ErrorDefinition::NOTE:
+      return m_clp->filterNote();
+    default:
+      return false;
+  }
+}
 
-  FileSystem* const fileSystem = FileSystem::getInstance();
-  std::multimap<ErrorDefinition::ErrorType, Waiver::WaiverData>& waivers =
-      Waiver::getWaivers();
-  std::pair<
-      std::multimap<ErrorDefinition::ErrorType, Waiver::WaiverData>::iterator,
-      std::multimap<ErrorDefinition::ErrorType, Waiver::WaiverData>::iterator>
-      ret = waivers.equal_range(error.m_errorId);
-  for (std::multimap<ErrorDefinition::ErrorType, Waiver::WaiverData>::iterator
-           it = ret.first;
-       it != ret.second; ++it) {
-    if ((((*it).second.m_fileName.empty()) ||
-         (fileSystem->toPath(error.m_locations[0].m_fileId) ==
-          (*it).second.m_fileName)) &&
-        (((*it).second.m_line == 0) ||
-         (error.m_locations[0].m_line == (*it).second.m_line)) &&
-        (((*it).second.m_objectId.empty()) ||
-         (m_symbolTable->getSymbol(error.m_locations[0].m_object) ==
-          (*it).second.m_objectId))) {
-      error.m_waived = true;
-      break;
+static uint32_t countOccurrences(std::string_view text,
+                                 std::string_view pattern) {
+  uint32_t count = 0;
+  for (size_t pos = text.find(pattern); pos != std::string_view::npos;
+       pos = text.find(pattern, pos + pattern.length())) {
+    ++count;
+  }
+  return count;
+}
+
+// Mirrors createErrorMessage(): two errors get the same key if and only if
+// they format to the same text, without formatting them.
+ErrorContainer::ErrorKey ErrorContainer::createErrorKey_(
+    const Error& error) const {
+  ErrorKey key;
+  if (error.m_reported || error.m_waived) return key;
+  const std::map<ErrorDefinition::ErrorType, ErrorDefinition::ErrorInfo>&
+      infoMap = ErrorDefinition::getErrorInfoMap();
+  std::map<ErrorDefinition::ErrorType,
+           ErrorDefinition::ErrorInfo>::const_iterator itr =
+      infoMap.find(error.m_errorId);
+  if (itr == infoMap.end()) return key;
+  const ErrorDefinition::ErrorInfo& info = (*itr).second;
+
+  // One slot per field of the main location, an unused field is a 0: the
+  // fields of two errors cannot line up against each other.
+  key.reserve(5 + 4 * error.m_locations.size());
+  key.emplace_back(error.m_errorId);
+  const Location& loc = error.m_locations[0];
+  const bool hasObject =
+      (countOccurrences(info.m_errorText, "%s") != 0) &&
+      (m_symbolTable->getSymbol(loc.m_object) != SymbolTable::getBadSymbol());
+  const bool hasLine = loc.m_fileId && (loc.m_line > 0);
+  key.emplace_back(hasObject ? (RawSymbolId)loc.m_object : BadRawSymbolId);
+  key.emplace_back((RawPathId)loc.m_fileId);
+  key.emplace_back(hasLine ? loc.m_line : 0);
+  key.emplace_back(hasLine ? loc.m_column : 0);
+
+  // Placeholders left in the text, in the same order they get replaced.
+  static constexpr uint32_t kExtraLocation = 0x80000000;
+  static constexpr uint32_t kExtraObject = 0x40000000;
+  static constexpr uint32_t kExtraTextShort = 0x20000000;
+  static constexpr uint32_t kExtraTextLong = 0x10000000;
+  uint32_t nbExtraLoc = countOccurrences(info.m_errorText, "%exloc");
+  uint32_t nbExtraObj = countOccurrences(info.m_errorText, "%exobj");
+  bool extraTextAppended = info.m_extraText.empty();
+  auto appendExtraText = [&](uint32_t marker) {
+    if (extraTextAppended) return;
+    extraTextAppended = true;
+    key.emplace_back(marker);
+    nbExtraLoc += countOccurrences(info.m_extraText, "%exloc");
+    nbExtraObj += countOccurrences(info.m_extraText, "%exobj");
+  };
+  for (uint32_t i = 1; i < error.m_locations.size(); i++) {
+    const Location& extraLoc = error.m_locations[i];
+    if (extraLoc.m_fileId) {
+      if (nbExtraLoc == 0) appendExtraText(kExtraTextLong);
+      if (nbExtraLoc != 0) {
+        --nbExtraLoc;
+        key.emplace_back(kExtraLocation | i);
+        key.emplace_back((RawPathId)extraLoc.m_fileId);
+        key.emplace_back(extraLoc.m_line);
+        key.emplace_back((extraLoc.m_line > 0) ? extraLoc.m_column : 0);
+      }
+    } else {
+      appendExtraText((i == 1) ? kExtraTextShort : kExtraTextLong);
+    }
+    if (extraLoc.m_object && (nbExtraObj != 0)) {
+      --nbExtraObj;
+      key.emplace_back(kExtraObject | i);
+      key.emplace_back((RawSymbolId)extraLoc.m_object);
     }
   }
+  return key;
+}
 
+size_t ErrorContainer::ErrorKeyHash::operator()(const ErrorKey& key) const {
+  size_t hash = key.size();
+  for (uint32_t value : key) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+Error& ErrorContainer::addError(Error& error, bool showDuplicates,
+                                bool /* reentrantPython */) {
+  // The message is only formatted when printed.
+  if (isFiltered_(error)) return error;
+
+  FileSystem* const fileSystem = FileSystem::getInstance();
   // Copy the PathId into our local SymbolTable!
   for (Location& loc : error.m_locations) {
     if (loc.m_fileId) {
@@ -108,13 +189,19 @@ Error& ErrorContainer::addError(Error& error, bool showDuplicates,
     }
   }
 
-  if (showDuplicates) {
+  // Keyed before the waivers apply, like the text was.
+  ErrorKey key;
+  if (!showDuplicates) key = createErrorKey_(error);
+
+  const Location& first = error.m_locations[0];
+  if (Waiver::hasWaivers(error.m_errorId) &&
+      Waiver::isWaived(error.m_errorId, fileSystem->toPath(first.m_fileId),
+                       first.m_line, m_symbolTable->getSymbol(first.m_object))) {
+    error.m_waived = true;
+  }
+
+  if (showDuplicates || m_errorSet.insert(std::move(key)).second) {
     m_errors.emplace_back(error);
-  } else {
-    if (m_errorSet.find(std::get<0>(textStatus)) == m_errorSet.end()) {
-      m_errors.emplace_back(error);
-      m_errorSet.insert(std::get<0>(textStatus));
-    }
   }
   return m_errors.back();
 }
@@ -340,7 +427,7 @@ bool ErrorContainer::printStats(ErrorContainer::Stats stats, bool muteStdout) {
   if (!muteStdout) {
     std::cout << report << std::flush;
   }
-  bool successLogFile = printToLogFile(report);
+  bool successLogFile = printToLogFile(report) && flushLogFile();
   return (successLogFile && (!stats.nbFatal) && (!stats.nbSyntax));
 }
 
@@ -382,9 +469,8 @@ ErrorContainer::Stats ErrorContainer::getErrorStats() const {
   return stats;
 }
 
-bool ErrorContainer::printToLogFile(std::string_view report) {
-  LogListener::LogResult result;
-  if (LogListener::failed(result = m_logListener->log(report))) {
+bool ErrorContainer::checkLogResult_(LogListener::LogResult result) {
+  if (LogListener::failed(result)) {
     if (!m_reportedFatalErrorLogFile &&
         (result == LogListener::LogResult::FailedToOpenFileForWrite)) {
       FileSystem* const fileSystem = FileSystem::getInstance();
@@ -398,6 +484,14 @@ bool ErrorContainer::printToLogFile(std::string_view report) {
   return true;
 }
 
+bool ErrorContainer::printToLogFile(std::string_view report) {
+  return checkLogResult_(m_logListener->log(report));
+}
+
+bool ErrorContainer::flushLogFile() {
+  return checkLogResult_(m_logListener->flush());
+}
+
 bool ErrorContainer::printMessage(Error& error, bool muteStdout) {
   if (error.m_reported) return false;
   std::pair<std::string, bool> report = createReport_(error);
@@ -406,6 +500,8 @@ bool ErrorContainer::printMessage(Error& error, bool muteStdout) {
     std::cout << report.first << std::flush;
   }
   bool successLogFile = printToLogFile(report.first);
+  // Nothing batched is lost if the fatal error ends the run.
+  if (successLogFile && report.second) successLogFile = flushLogFile();
   if (successLogFile) error.m_reported = true;
   return (successLogFile && (!report.second));
 }
@@ -416,6 +512,7 @@ bool ErrorContainer::printMessages(bool muteStdout) {
     std::cout << report.first << std::flush;
   }
   bool successLogFile = printToLogFile(report.first);
+  if (successLogFile && report.second) successLogFile = flushLogFile();
   if (successLogFile) {
     for (auto& err : m_errors) {
       err.m_reported = true;
@@ -0,0 +1,84 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/ErrorReporting/ErrorContainer.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+
+#include "Surelog/Common/FileSystem.h"
+#include "Surelog/Common/PathId.h"
+#include "Surelog/Common/PlatformFileSystem.h"
+#include "Surelog/ErrorReporting/Error.h"
+#include "Surelog/ErrorReporting/ErrorDefinition.h"
+#include "Surelog/ErrorReporting/Location.h"
+#include "Surelog/SourceCompile/SymbolTable.h"
+
+namespace SURELOG {
+
+namespace fs = std::filesystem;
+
+namespace {
+class TestFileSystem : public PlatformFileSystem {
+ public:
+  explicit TestFileSystem(const fs::path &wd) : PlatformFileSystem(wd) {
+    FileSystem::setInstance(this);
+  }
+};
+
+TEST(ErrorContainerTest, DuplicateKeys) {
+  const fs::path testdir = testing::TempDir();
+  std::unique_ptr<TestFileSystem> fileSystem(new TestFileSystem(testdir));
+  std::unique_ptr<SymbolTable> symbolTable(new SymbolTable);
+  ErrorDefinition::init();
+  ErrorContainer errors(symbolTable.get());
+
+  const PathId fileA =
+      fileSystem->toPathId((testdir / "a.sv").string(), symbolTable.get());
+  const PathId fileB =
+      fileSystem->toPathId((testdir / "b.sv").string(), symbolTable.get());
+  const uint32_t rawB = (RawPathId)fileB;
+
+  // Same text, only the first one is kept.
+  Error first(ErrorDefinition::PP_CANNOT_OPEN_FILE,
+              Location(fileB, 3, 0, (SymbolId)fileA));
+  Error same(ErrorDefinition::PP_CANNOT_OPEN_FILE,
+             Location(fileB, 3, 0, (SymbolId)fileA));
+  errors.addError(first);
+  errors.addError(same);
+  EXPECT_EQ(errors.getErrors().size(), 1u);
+
+  // Without an object, the file, line and column take the same values as
+  // the object, file and line above: a different message.
+  Error shifted(ErrorDefinition::PP_CANNOT_OPEN_FILE,
+                Location(fileA, rawB, 3));
+  errors.addError(shifted);
+  EXPECT_EQ(errors.getErrors().size(), 2u);
+
+  // A column only differs from no column.
+  Error column(ErrorDefinition::PP_CANNOT_OPEN_FILE,
+               Location(fileB, 3, 1, (SymbolId)fileA));
+  errors.addError(column);
+  EXPECT_EQ(errors.getErrors().size(), 3u);
+
+  // Duplicates are kept on request.
+  errors.addError(same, true);
+  EXPECT_EQ(errors.getErrors().size(), 4u);
+}
+}  // namespace
+}  // namespace SURELOG
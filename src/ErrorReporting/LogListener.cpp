@@ -61,6 +61,16 @@ int32_t LogListener::getMaxQueuedMessageCount() const {
   return maxQueuedMessageCount;
 }
 
+void LogListener::setMaxBatchSize(uint32_t size) {
+  std::scoped_lock<std::mutex> lock(mutex);
+  maxBatchSize = size;
+}
+
+uint32_t LogListener::getMaxBatchSize() const {
+  std::scoped_lock<std::mutex> lock(mutex);
+  return maxBatchSize;
+}
+
 int32_t LogListener::getQueuedMessageCount() const {
   std::scoped_lock<std::mutex> lock(mutex);
   return static_cast<int32_t>(queued.size());
@@ -93,26 +103,41 @@ void LogListener::flush(std::ostream &strm) {
   strm << std::flush;
 }
 
-LogListener::LogResult LogListener::flush() {
-  std::scoped_lock<std::mutex> lock(mutex);
-
-  if (queued.empty()) {
-    return LogResult::Ok;  // Nothing to flush!
-  }
+LogListener::LogResult LogListener::write() {
+  // NOTE: This isn't guarded since this is expected to be used only via
+  // public API (which in turn are reponsible for ensuring thread-safety)
 
   FileSystem *const fileSystem = FileSystem::getInstance();
   std::ostream &strm =
       fileSystem->openOutput(fileId, std::ios_base::out | std::ios_base::app);
   if (!strm.good()) {
+    // Kept for a later attempt, within the bounds of the queue.
+    if (!batch.empty()) enqueue(batch);
+    batch.clear();
     fileSystem->close(strm);
     return LogResult::FailedToOpenFileForWrite;
   }
 
-  flush(strm);
+  if (!queued.empty()) {
+    flush(strm);
+  }
+
+  strm << batch << std::flush;
+  batch.clear();
   fileSystem->close(strm);
   return LogResult::Ok;
 }
 
+LogListener::LogResult LogListener::flush() {
+  std::scoped_lock<std::mutex> lock(mutex);
+
+  if (queued.empty() && batch.empty()) {
+    return LogResult::Ok;  // Nothing to flush!
+  }
+
+  return write();
+}
+
 LogListener::LogResult LogListener::log(std::string_view message) {
   std::scoped_lock<std::mutex> lock(mutex);
 
@@ -121,22 +146,13 @@ LogListener::LogResult LogListener::log(std::string_view message) {
     return LogResult::Enqueued;
   }
 
-  FileSystem *const fileSystem = FileSystem::getInstance();
-  std::ostream &strm =
-      fileSystem->openOutput(fileId, std::ios_base::out | std::ios_base::app);
-  if (!strm.good()) {
-    enqueue(message);
-    fileSystem->close(strm);
-    return LogResult::FailedToOpenFileForWrite;
+  // Messages keep their order, they are only written later and together.
+  batch.append(message);
+  if (batch.size() < maxBatchSize) {
+    return LogResult::Ok;
   }
 
-  if (!queued.empty()) {
-    flush(strm);
-  }
-
-  strm << message << std::flush;
-  fileSystem->close(strm);
-  return LogResult::Ok;
+  return write();
 }
 
 }  // namespace SURELOG
@@ -0,0 +1,111 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/ErrorReporting/LogListener.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "Surelog/Common/FileSystem.h"
+#include "Surelog/Common/PathId.h"
+#include "Surelog/Common/PlatformFileSystem.h"
+#include "Surelog/SourceCompile/SymbolTable.h"
+#include "Surelog/Utils/StringUtils.h"
+
+namespace SURELOG {
+
+namespace fs = std::filesystem;
+
+namespace {
+class TestFileSystem : public PlatformFileSystem {
+ public:
+  explicit TestFileSystem(const fs::path &wd) : PlatformFileSystem(wd) {
+    FileSystem::setInstance(this);
+  }
+};
+
+std::string getUniqueTempFileName() {
+  return StrCat(::testing::UnitTest::GetInstance()->current_test_info()->name(),
+                "-",
+                std::chrono::steady_clock::now().time_since_epoch().count(),
+                ".log");
+}
+
+std::string readLog(FileSystem *fileSystem, PathId fileId) {
+  std::string content;
+  fileSystem->readContent(fileId, content);
+  return content;
+}
+
+TEST(LogListenerTest, BatchedWrites) {
+  const fs::path testdir = testing::TempDir();
+  std::unique_ptr<TestFileSystem> fileSystem(new TestFileSystem(testdir));
+  std::unique_ptr<SymbolTable> symbolTable(new SymbolTable);
+  const PathId fileId = fileSystem->toPathId(
+      (testdir / getUniqueTempFileName()).string(), symbolTable.get());
+
+  LogListener listener;
+  // Queued until the listener is initialized.
+  EXPECT_EQ(listener.log("early\n"), LogListener::LogResult::Enqueued);
+  EXPECT_EQ(listener.initialize(fileId), LogListener::LogResult::Ok);
+  listener.setMaxBatchSize(16);
+  EXPECT_EQ(listener.getMaxBatchSize(), 16u);
+
+  // Below the batch size, nothing is written yet.
+  EXPECT_EQ(listener.log("0123456789\n"), LogListener::LogResult::Ok);
+  EXPECT_EQ(readLog(fileSystem.get(), fileId), "");
+
+  // The batch is written in one go once full, after the queued messages.
+  EXPECT_EQ(listener.log("abcdefghij\n"), LogListener::LogResult::Ok);
+  EXPECT_EQ(readLog(fileSystem.get(), fileId),
+            "early\n0123456789\nabcdefghij\n");
+  EXPECT_EQ(listener.getQueuedMessageCount(), 0);
+
+  // A partial batch is written by flush().
+  EXPECT_EQ(listener.log("tail\n"), LogListener::LogResult::Ok);
+  EXPECT_EQ(readLog(fileSystem.get(), fileId),
+            "early\n0123456789\nabcdefghij\n");
+  EXPECT_EQ(listener.flush(), LogListener::LogResult::Ok);
+  EXPECT_EQ(readLog(fileSystem.get(), fileId),
+            "early\n0123456789\nabcdefghij\ntail\n");
+
+  // Without batching, every message is written as it is logged.
+  listener.setMaxBatchSize(0);
+  EXPECT_EQ(listener.log("now\n"), LogListener::LogResult::Ok);
+  EXPECT_EQ(readLog(fileSystem.get(), fileId),
+            "early\n0123456789\nabcdefghij\ntail\nnow\n");
+}
+
+TEST(LogListenerTest, NoWriteOnDestruction) {
+  const fs::path testdir = testing::TempDir();
+  std::unique_ptr<TestFileSystem> fileSystem(new TestFileSystem(testdir));
+  std::unique_ptr<SymbolTable> symbolTable(new SymbolTable);
+  const PathId fileId = fileSystem->toPathId(
+      (testdir / getUniqueTempFileName()).string(), symbolTable.get());
+  {
+    LogListener listener;
+    EXPECT_EQ(listener.initialize(fileId), LogListener::LogResult::Ok);
+    EXPECT_EQ(listener.log("unflushed\n"), LogListener::LogResult::Ok);
+  }
+  // The owner flushes while the log file id can still be resolved.
+  EXPECT_EQ(readLog(fileSystem.get(), fileId), "");
+}
+}  // namespace
+}  // namespace SURELOG
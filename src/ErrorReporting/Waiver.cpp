@@ -28,6 +28,7 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <tuple>
 
 #include "Surelog/ErrorReporting/ErrorDefinition.h"
 
@@ -35,6 +36,7 @@ namespace SURELOG {
 
 std::set<std::string, std::less<>> Waiver::m_macroArgCheck;
 std::multimap<ErrorDefinition::ErrorType, Waiver::WaiverData> Waiver::m_waivers;
+std::set<Waiver::WaiverKey, std::less<>> Waiver::m_waiverIndex;
 
 // Example of message to waive:
 // [WARNI:PP0113] ../../../UVM/uvm-1.2/src/macros/uvm_callback_defines.svh, line
@@ -45,6 +47,23 @@ void Waiver::setWaiver(std::string_view messageId, std::string_view fileName,
   ErrorDefinition::ErrorType type = ErrorDefinition::getErrorType(messageId);
   Waiver::WaiverData data(type, fileName, line, objectName);
   m_waivers.emplace(type, data);
+  m_waiverIndex.emplace(type, fileName, line, objectName);
+}
+
+bool Waiver::isWaived(ErrorDefinition::ErrorType type,
+                      std::string_view fileName, uint32_t line,
+                      std::string_view objectName) {
+  if (!hasWaivers(type)) return false;
+  // Probes the exact key and every combination of wildcards.
+  for (uint32_t wildcards = 0; wildcards < 8; ++wildcards) {
+    const std::tuple<ErrorDefinition::ErrorType, std::string_view, uint32_t,
+                     std::string_view>
+        key(type, (wildcards & 1) ? std::string_view() : fileName,
+            (wildcards & 2) ? 0 : line,
+            (wildcards & 4) ? std::string_view() : objectName);
+    if (m_waiverIndex.find(key) != m_waiverIndex.end()) return true;
+  }
+  return false;
 }
 
 void Waiver::initWaivers() { m_macroArgCheck.insert("vmm_sformatf"); }
@@ -0,0 +1,56 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/ErrorReporting/Waiver.h"
+
+#include <gtest/gtest.h>
+
+#include "Surelog/ErrorReporting/ErrorDefinition.h"
+
+namespace SURELOG {
+
+namespace {
+TEST(WaiverTest, Wildcards) {
+  const ErrorDefinition::ErrorType exact =
+      ErrorDefinition::getErrorType("[WARNI:PP0113]");
+  const ErrorDefinition::ErrorType anyFile =
+      ErrorDefinition::getErrorType("[WARNI:PP0114]");
+  const ErrorDefinition::ErrorType anyObject =
+      ErrorDefinition::getErrorType("[WARNI:PP0115]");
+  Waiver::setWaiver("[WARNI:PP0113]", "a.sv", 12, "CB");
+  Waiver::setWaiver("[WARNI:PP0114]", "", 0, "CB");
+  Waiver::setWaiver("[WARNI:PP0115]", "b.sv", 3, "");
+
+  EXPECT_TRUE(Waiver::hasWaivers(exact));
+  EXPECT_TRUE(Waiver::isWaived(exact, "a.sv", 12, "CB"));
+  EXPECT_FALSE(Waiver::isWaived(exact, "a.sv", 13, "CB"));
+  EXPECT_FALSE(Waiver::isWaived(exact, "b.sv", 12, "CB"));
+  EXPECT_FALSE(Waiver::isWaived(exact, "a.sv", 12, "CA"));
+
+  EXPECT_TRUE(Waiver::isWaived(anyFile, "a.sv", 12, "CB"));
+  EXPECT_TRUE(Waiver::isWaived(anyFile, "c.sv", 1, "CB"));
+  EXPECT_FALSE(Waiver::isWaived(anyFile, "c.sv", 1, "CA"));
+
+  EXPECT_TRUE(Waiver::isWaived(anyObject, "b.sv", 3, "X"));
+  EXPECT_FALSE(Waiver::isWaived(anyObject, "b.sv", 4, "X"));
+
+  const ErrorDefinition::ErrorType none =
+      ErrorDefinition::getErrorType("[WARNI:PP0116]");
+  EXPECT_FALSE(Waiver::hasWaivers(none));
+  EXPECT_FALSE(Waiver::isWaived(none, "a.sv", 12, "CB"));
+}
+}  // namespace
+}  // namespace SURELOG
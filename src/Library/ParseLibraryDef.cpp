@@ -167,7 +167,8 @@ bool ParseLibraryDef::parseConfigDefinition() {
   FileContent* fC = m_fileContent;
   if (!fC) return false;
 
-  VObjectTypeUnorderedSet types = {VObjectType::paConfig_declaration};
+  static constexpr VObjectTypeBitSet types = {
+      VObjectType::paConfig_declaration};
   std::vector<NodeId> configs = fC->sl_collect_all(fC->getRootNode(), types);
   for (auto config : configs) {
     NodeId ident = fC->Child(config);
@@ -177,7 +178,8 @@ bool ParseLibraryDef::parseConfigDefinition() {
     Config conf(name, fC, config);
 
     // Design clause
-    VObjectTypeUnorderedSet designStmt = {VObjectType::paDesign_statement};
+    static constexpr VObjectTypeBitSet designStmt = {
+        VObjectType::paDesign_statement};
     std::vector<NodeId> designs = fC->sl_collect_all(config, designStmt);
     if (designs.empty()) {
       // TODO: Error
@@ -197,7 +199,8 @@ bool ParseLibraryDef::parseConfigDefinition() {
     }
 
     // Default clause
-    VObjectTypeUnorderedSet defaultStmt = {VObjectType::paDefault_clause};
+    static constexpr VObjectTypeBitSet defaultStmt = {
+        VObjectType::paDefault_clause};
     std::vector<NodeId> defaults = fC->sl_collect_all(config, defaultStmt);
     if (!defaults.empty()) {
       NodeId defaultClause = defaults[0];
@@ -212,8 +215,8 @@ bool ParseLibraryDef::parseConfigDefinition() {
     }
 
     // Instance and Cell clauses
-    VObjectTypeUnorderedSet instanceStmt = {VObjectType::paInst_clause,
-                                            VObjectType::paCell_clause};
+    static constexpr VObjectTypeBitSet instanceStmt = {
+        VObjectType::paInst_clause, VObjectType::paCell_clause};
     std::vector<NodeId> instances = fC->sl_collect_all(config, instanceStmt);
     for (auto inst : instances) {
       VObjectType type = fC->Type(inst);
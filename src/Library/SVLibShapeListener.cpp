@@ -23,7 +23,6 @@
 
 #include "Surelog/Library/SVLibShapeListener.h"
 
-#include <regex>
 #include <string>
 #include <string_view>
 
@@ -44,6 +43,7 @@
 #include "Surelog/SourceCompile/SymbolTable.h"
 #include "Surelog/SourceCompile/VObjectTypes.h"
 #include "Surelog/Utils/ParseUtils.h"
+#include "Surelog/Utils/StringUtils.h"
 
 namespace SURELOG {
 SVLibShapeListener::SVLibShapeListener(ParseLibraryDef *parser,
@@ -195,7 +195,7 @@ void SVLibShapeListener::exitHierarchical_identifier(
 
   childCtx = (antlr4::ParserRuleContext *)ctx->children[0];
   ident = ctx->getText();
-  ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+  StringUtils::eraseAll(&ident, EscapeSequence);
   addVObject(childCtx, ident, VObjectType::slStringConst);
   addVObject(ctx, VObjectType::paHierarchical_identifier);
 
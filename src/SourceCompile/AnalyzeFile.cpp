@@ -23,9 +23,9 @@
 
 #include "Surelog/SourceCompile/AnalyzeFile.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
-#include <regex>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -47,6 +47,8 @@
 namespace SURELOG {
 void AnalyzeFile::checkSLlineDirective_(std::string_view line,
                                         uint32_t lineNb) {
+  // Most lines are not directives, skip them before setting up a stream.
+  if (!StringUtils::startsWith(StringUtils::ltrim(line), "SLline")) return;
   std::stringstream ss(
       (std::string(line))); /* Storing the whole string into string stream */
   std::string keyword;
@@ -107,6 +109,33 @@ std::string AnalyzeFile::setSLlineDirective_(uint32_t lineNb) {
   return result.str();
 }
 
+// Whether "line" contains a package import: "import" followed by spaces, the
+// imported name (made of [a-zA-Z_0-9:*]), optional spaces and ';'.
+static bool containsImport(std::string_view line) {
+  static constexpr std::string_view kImport = "import";
+  for (size_t pos = line.find(kImport); pos != std::string_view::npos;
+       pos = line.find(kImport, pos + 1)) {
+    size_t i = pos + kImport.length();
+    const size_t spaces = i;
+    while ((i < line.length()) && (line[i] == ' ')) ++i;
+    if (i == spaces) continue;
+    const size_t name = i;
+    while (i < line.length()) {
+      const char c = line[i];
+      if (!(((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+            ((c >= '0') && (c <= '9')) || (c == '_') || (c == ':') ||
+            (c == '*'))) {
+        break;
+      }
+      ++i;
+    }
+    if (i == name) continue;
+    while ((i < line.length()) && (line[i] == ' ')) ++i;
+    if ((i < line.length()) && (line[i] == ';')) return true;
+  }
+  return false;
+}
+
 void AnalyzeFile::analyze() {
   FileSystem* const fileSystem = FileSystem::getInstance();
   SymbolTable* const symbolTable = m_clp->getSymbolTable();
@@ -117,12 +146,14 @@ void AnalyzeFile::analyze() {
   if (m_text.empty()) {
     fileSystem->readLines(m_ppFileId, allLines);
   } else {
-    std::string line;
-    std::stringstream ss(m_text);
-    while (std::getline(ss, line)) {
-      while (!line.empty() &&
-             ((line.back() == '\r') || (line.back() == '\n'))) {
-        line.pop_back();
+    std::string_view text = m_text;
+    while (!text.empty()) {
+      const size_t eol = text.find('\n');
+      std::string_view line = text.substr(0, eol);
+      text.remove_prefix((eol == std::string_view::npos) ? text.size()
+                                                         : eol + 1);
+      while (!line.empty() && (line.back() == '\r')) {
+        line.remove_suffix(1);
       }
       allLines.emplace_back(line);
     }
@@ -159,8 +190,6 @@ void AnalyzeFile::analyze() {
   int32_t nbPrimitive = 0 /*./re   , nbFunction = 0, nbTask = 0*/;
   std::string prev_keyword;
   std::string prev_prev_keyword;
-  const std::regex import_regex("import[ ]+[a-zA-Z_0-9:\\*]+[ ]*;");
-  std::smatch pieces_match;
   std::string fileLevelImportSection;
   // Parse the file
   for (const auto& line : allLines) {
@@ -382,7 +411,7 @@ void AnalyzeFile::analyze() {
     if ((!inPackage) && (!inClass) && (!inModule) && (!inProgram) &&
         (!inInterface) && (!inConfig) && (!inChecker) && (!inPrimitive) &&
         (!inComment) && (!inString)) {
-      if (std::regex_search(line, pieces_match, import_regex)) {
+      if (containsImport(line)) {
         fileLevelImportSection += line;
       }
     }
@@ -430,8 +459,8 @@ void AnalyzeFile::analyze() {
       packageDeclaration = allLines[fileChunks[i].m_fromLine];
       for (uint32_t hi = fileChunks[i].m_fromLine; hi < fileChunks[i].m_toLine;
            hi++) {
-        std::string header = allLines[hi];
-        if (std::regex_search(header, pieces_match, import_regex)) {
+        const std::string& header = allLines[hi];
+        if (containsImport(header)) {
           importSection += header;
         }
       }
@@ -27,6 +27,8 @@
 #include <parser/SV3_1aLexer.h>
 #include <parser/SV3_1aParser.h>
 
+#include <cstdint>
+
 #include "Surelog/SourceCompile/AntlrParserErrorListener.h"
 
 namespace SURELOG {
@@ -44,4 +46,11 @@ AntlrParserHandler::~AntlrParserHandler() {
   delete m_lexer;
   delete m_inputStream;
 }
+
+uint64_t AntlrParserHandler::getMemoryUsage() const {
+  uint64_t bytes = 0;
+  if (m_inputStream) bytes += m_inputStream->size() * sizeof(char32_t);
+  if (m_tokens) bytes += m_tokens->size() * sizeof(antlr4::CommonToken);
+  return bytes;
+}
 }  // namespace SURELOG
@@ -23,6 +23,7 @@
 #include "Surelog/SourceCompile/CompilationUnit.h"
 
 #include <cstdint>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -34,14 +35,36 @@ namespace SURELOG {
 CompilationUnit::CompilationUnit(bool fileunit)
     : m_fileunit(fileunit), m_inDesignElement(false) {}
 
-MacroInfo* CompilationUnit::getMacroInfo(std::string_view macroName) {
-  MacroStorageRef::iterator itr = m_macros.find(macroName);
+CompilationUnit::CompilationUnit(CompilationUnit* base)
+    : m_fileunit(base->m_fileunit),
+      m_inDesignElement(base->m_inDesignElement),
+      m_base(base),
+      m_baseInDesignElement(base->m_inDesignElement) {}
+
+MacroInfo* CompilationUnit::findMacroInfo_(std::string_view macroName) const {
+  MacroStorageRef::const_iterator itr = m_macros.find(macroName);
   if (itr != m_macros.end()) {
     return itr->second.back();
   }
   return nullptr;
 }
 
+MacroInfo* CompilationUnit::getMacroInfo(std::string_view macroName) {
+  if (MacroInfo* macro = findMacroInfo_(macroName)) {
+    return macro;
+  }
+  if ((m_base == nullptr) || m_baseMacrosDeleted ||
+      (m_deletedBaseMacros.find(macroName) != m_deletedBaseMacros.end())) {
+    return nullptr;
+  }
+  auto itr = m_baseMacroReads.find(macroName);
+  if (itr == m_baseMacroReads.end()) {
+    MacroInfo* const macro = m_base->findMacroInfo_(macroName);
+    itr = m_baseMacroReads.emplace(std::string(macroName), macro).first;
+  }
+  return itr->second;
+}
+
 void CompilationUnit::registerMacroInfo(std::string_view macroName,
                                         MacroInfo* macro) {
   MacroStorageRef::iterator itr = m_macros.find(macroName);
@@ -49,6 +72,12 @@ void CompilationUnit::registerMacroInfo(std::string_view macroName,
     itr = m_macros.emplace(macroName, std::vector<MacroInfo*>{}).first;
   }
   itr->second.push_back(macro);
+  if (m_base != nullptr) {
+    m_changes.emplace_back(
+        [name = std::string(macroName), macro](CompilationUnit* unit) {
+          unit->registerMacroInfo(name, macro);
+        });
+  }
 }
 
 void CompilationUnit::deleteMacro(std::string_view macroName) {
@@ -56,10 +85,50 @@ void CompilationUnit::deleteMacro(std::string_view macroName) {
   if (itr != m_macros.end()) {
     m_macros.erase(itr);
   }
+  if (m_base != nullptr) {
+    m_deletedBaseMacros.emplace(macroName);
+    m_changes.emplace_back(
+        [name = std::string(macroName)](CompilationUnit* unit) {
+          unit->deleteMacro(name);
+        });
+  }
+}
+
+void CompilationUnit::deleteAllMacros() {
+  m_macros.clear();
+  if (m_base != nullptr) {
+    m_baseMacrosDeleted = true;
+    m_changes.emplace_back(
+        [](CompilationUnit* unit) { unit->deleteAllMacros(); });
+  }
+}
+
+bool CompilationUnit::isValidSpeculation() const {
+  if (m_base->m_inDesignElement != m_baseInDesignElement) {
+    return false;
+  }
+  for (const auto& [name, macro] : m_baseMacroReads) {
+    if (m_base->findMacroInfo_(name) != macro) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void CompilationUnit::commitSpeculation() {
+  for (const auto& change : m_changes) {
+    change(m_base);
+  }
+  m_changes.clear();
+  m_base->m_inDesignElement = m_inDesignElement;
 }
 
 void CompilationUnit::recordTimeInfo(TimeInfo& info) {
   m_timeInfo.push_back(info);
+  if (m_base != nullptr) {
+    m_changes.emplace_back(
+        [info](CompilationUnit* unit) mutable { unit->recordTimeInfo(info); });
+  }
 }
 
 TimeInfo& CompilationUnit::getTimeInfo(PathId fileId, uint32_t line) {
@@ -79,6 +148,11 @@ TimeInfo& CompilationUnit::getTimeInfo(PathId fileId, uint32_t line) {
 
 void CompilationUnit::recordDefaultNetType(NetTypeInfo& info) {
   m_defaultNetTypes.push_back(info);
+  if (m_base != nullptr) {
+    m_changes.emplace_back([info](CompilationUnit* unit) mutable {
+      unit->recordDefaultNetType(info);
+    });
+  }
 }
 
 VObjectType CompilationUnit::getDefaultNetType(PathId fileId, uint32_t line) {
@@ -97,10 +171,18 @@ VObjectType CompilationUnit::getDefaultNetType(PathId fileId, uint32_t line) {
 }
 
 void CompilationUnit::setCurrentTimeInfo(PathId fileId) {
-  if (m_timeInfo.empty()) {
+  if (m_base != nullptr) {
+    m_changes.emplace_back([fileId](CompilationUnit* unit) {
+      unit->setCurrentTimeInfo(fileId);
+    });
+  }
+  const std::vector<TimeInfo>& timeInfo =
+      (m_timeInfo.empty() && (m_base != nullptr)) ? m_base->m_timeInfo
+                                                   : m_timeInfo;
+  if (timeInfo.empty()) {
     return;
   }
-  TimeInfo info = m_timeInfo[m_timeInfo.size() - 1];
+  TimeInfo info = timeInfo[timeInfo.size() - 1];
   info.m_fileId = fileId;
   info.m_line = 1;
   m_timeInfo.push_back(info);
@@ -0,0 +1,88 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/SourceCompile/CompilationUnit.h"
+
+#include <gtest/gtest.h>
+
+#include "Surelog/Common/PathId.h"
+#include "Surelog/SourceCompile/MacroInfo.h"
+
+namespace SURELOG {
+
+namespace {
+MacroInfo makeMacro(std::string_view name) {
+  return MacroInfo(name, MacroInfo::NO_ARGS, BadPathId, 1, 0, 1, 0, {}, {});
+}
+
+TEST(CompilationUnitTest, SpeculativeLookup) {
+  MacroInfo a = makeMacro("A");
+  MacroInfo b = makeMacro("B");
+  MacroInfo c = makeMacro("C");
+  CompilationUnit shared(false);
+  shared.registerMacroInfo("A", &a);
+  shared.registerMacroInfo("B", &b);
+
+  CompilationUnit speculative(&shared);
+  EXPECT_TRUE(speculative.isSpeculative());
+  EXPECT_FALSE(speculative.isFileUnit());
+  EXPECT_EQ(speculative.getMacroInfo("A"), &a);
+  speculative.deleteMacro("B");
+  EXPECT_EQ(speculative.getMacroInfo("B"), nullptr);
+  speculative.registerMacroInfo("C", &c);
+  EXPECT_EQ(speculative.getMacroInfo("C"), &c);
+
+  // The shared unit is untouched until the commit.
+  EXPECT_EQ(shared.getMacroInfo("B"), &b);
+  EXPECT_EQ(shared.getMacroInfo("C"), nullptr);
+  EXPECT_TRUE(speculative.isValidSpeculation());
+  speculative.commitSpeculation();
+  EXPECT_EQ(shared.getMacroInfo("A"), &a);
+  EXPECT_EQ(shared.getMacroInfo("B"), nullptr);
+  EXPECT_EQ(shared.getMacroInfo("C"), &c);
+
+  CompilationUnit undefineAll(&shared);
+  undefineAll.deleteAllMacros();
+  EXPECT_EQ(undefineAll.getMacroInfo("A"), nullptr);
+  EXPECT_EQ(shared.getMacroInfo("A"), &a);
+}
+
+TEST(CompilationUnitTest, SpeculationInvalidation) {
+  MacroInfo a = makeMacro("A");
+  MacroInfo a2 = makeMacro("A");
+  CompilationUnit shared(false);
+  shared.registerMacroInfo("A", &a);
+
+  // Both files run before the first one is committed.
+  CompilationUnit first(&shared);
+  CompilationUnit second(&shared);
+  CompilationUnit third(&shared);
+  first.registerMacroInfo("A", &a2);
+  first.setInDesignElement();
+  EXPECT_EQ(second.getMacroInfo("A"), &a);
+  EXPECT_EQ(third.getMacroInfo("B"), nullptr);
+
+  EXPECT_TRUE(first.isValidSpeculation());
+  first.commitSpeculation();
+  EXPECT_EQ(shared.getMacroInfo("A"), &a2);
+  EXPECT_TRUE(shared.isInDesignElement());
+  // "second" read the previous definition of A, "third" ran outside of the
+  // design element the first file left open.
+  EXPECT_FALSE(second.isValidSpeculation());
+  EXPECT_FALSE(third.isValidSpeculation());
+}
+}  // namespace
+}  // namespace SURELOG
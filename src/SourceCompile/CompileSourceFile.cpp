@@ -27,6 +27,8 @@
 #include "Surelog/Common/FileSystem.h"
 #include "Surelog/Common/PathId.h"
 #include "Surelog/Common/SymbolId.h"
+#include "Surelog/Design/Design.h"
+#include "Surelog/Design/FileContent.h"
 #include "Surelog/ErrorReporting/Error.h"
 #include "Surelog/ErrorReporting/ErrorContainer.h"
 #include "Surelog/ErrorReporting/ErrorDefinition.h"
@@ -34,9 +36,11 @@
 #include "Surelog/Library/Library.h"
 #include "Surelog/Package/Precompiled.h"
 #include "Surelog/SourceCompile/AnalyzeFile.h"
+#include "Surelog/SourceCompile/CompilationUnit.h"
 #include "Surelog/SourceCompile/Compiler.h"
 #include "Surelog/SourceCompile/ParseFile.h"
 #include "Surelog/SourceCompile/SymbolTable.h"
+#include "Surelog/Utils/Timer.h"
 
 #ifdef SURELOG_WITH_PYTHON
 #include <Python.h>
@@ -50,6 +54,7 @@
 #endif
 
 #include <iostream>
+#include <set>
 
 namespace SURELOG {
 
@@ -75,6 +80,7 @@ CompileSourceFile::CompileSourceFile(CompileSourceFile* parent,
       m_errors(parent->m_errors),
       m_compiler(parent->m_compiler),
       m_pp(parent->m_pp),
+      m_symbolTable(parent->m_symbolTable),
       m_compilationUnit(parent->m_compilationUnit),
       m_action(Parse),
       m_ppResultFileId(ppResultFileId),
@@ -87,13 +93,12 @@ CompileSourceFile::CompileSourceFile(CompileSourceFile* parent,
       new ParseFile(this, parent->m_parser, m_ppResultFileId, lineOffset);
 }
 
-bool CompileSourceFile::compile(Action action) {
-  m_action = action;
+void CompileSourceFile::reportProcessing(Action action) {
   if (m_commandLineParser->verbose()) {
     Location loc(m_fileId);
     ErrorDefinition::ErrorType type =
         ErrorDefinition::PP_PROCESSING_SOURCE_FILE;
-    switch (m_action) {
+    switch (action) {
       case Preprocess:
       case PostPreprocess:
         type = ErrorDefinition::PP_PROCESSING_SOURCE_FILE;
@@ -110,12 +115,21 @@ bool CompileSourceFile::compile(Action action) {
       m_errors->printMessage(m_errors->addError(err, true));
     }
   }
+}
+
+bool CompileSourceFile::compile(Action action) {
+  m_action = action;
+  // A speculative run is reported by the thread committing it, in file order
+  if (!m_speculative) reportProcessing(action);
 
   switch (m_action) {
     case Preprocess:
       return preprocess_();
-    case PostPreprocess:
-      return postPreprocess_();
+    case PostPreprocess: {
+      const bool status = postPreprocess_();
+      if (m_commandLineParser->streaming()) releasePreprocessorState_();
+      return status;
+    }
     case Parse:
       return parse_();
     case PythonAPI: {
@@ -203,7 +217,16 @@ bool CompileSourceFile::initParser() {
 
 bool CompileSourceFile::parse_() {
   initParser();
-  if (!m_parser->parse()) {
+  Timer timer;
+  const bool status = m_parser->parse();
+  m_parseSeconds = timer.elapsed();
+  // The chunks of a split file are parsed before their parent recombines them
+  for (const ParseFile* chunk : m_parser->getChildren()) {
+    m_parseSeconds += chunk->getCompileSourceFile()->getParseSeconds();
+  }
+  // Not needed anymore if the parse cache was used
+  releasePpResult();
+  if (!status) {
     return false;
   }
   bool fatalErrors = m_errors->hasFatalErrors();
@@ -240,7 +263,14 @@ bool CompileSourceFile::preprocess_() {
   if (fatalErrors) {
     return false;
   }
+  // The cache of a speculative run is saved once it is committed
+  if (m_compilationUnit->isSpeculative()) {
+    return true;
+  }
+  return savePreprocess_();
+}
 
+bool CompileSourceFile::savePreprocess_() {
   if (m_commandLineParser->getDebugIncludeFileInfo())
     std::cerr << m_pp->reportIncludeInfo();
 
@@ -253,17 +283,80 @@ bool CompileSourceFile::preprocess_() {
   return true;
 }
 
+void CompileSourceFile::beginSpeculativePreprocess() {
+  m_speculative = true;
+  m_compilationUnit = new CompilationUnit(m_compilationUnit);
+}
+
+bool CompileSourceFile::endSpeculativePreprocess(bool status,
+                                                 bool* committed) {
+  m_speculative = false;
+  CompilationUnit* const speculativeUnit = m_compilationUnit;
+  m_compilationUnit = speculativeUnit->getBase();
+  *committed = speculativeUnit->isValidSpeculation();
+  if (*committed) {
+    speculativeUnit->commitSpeculation();
+    for (PreprocessFile* pp : m_ppIncludeVec) {
+      pp->setCompilationUnit(m_compilationUnit);
+    }
+  } else {
+    dropPreprocess_();
+  }
+  delete speculativeUnit;
+  if (*committed && status && !m_errors->hasFatalErrors()) {
+    return savePreprocess_();
+  }
+  return status;
+}
+
+void CompileSourceFile::discardSpeculativePreprocess() {
+  m_speculative = false;
+  CompilationUnit* const speculativeUnit = m_compilationUnit;
+  m_compilationUnit = speculativeUnit->getBase();
+  dropPreprocess_();
+  delete speculativeUnit;
+}
+
+void CompileSourceFile::dropPreprocess_() {
+  // Drop everything the run produced. The macros it defined go with the
+  // PreprocessFiles owning them, the layer that registered them is never
+  // committed. The Antlr handlers go too, as a reused handler would not
+  // report its syntax errors again.
+  std::set<FileContent*> contents;
+  for (PreprocessFile* pp : m_ppIncludeVec) {
+    if (pp->getFileContent() != nullptr) {
+      contents.insert(pp->getFileContent());
+    }
+    delete pp;
+  }
+  m_ppIncludeVec.clear();
+  m_pp = nullptr;
+  m_compiler->getDesign()->deletePPFileContents(contents);
+  for (auto& entry : m_antlrPpMacroMap) {
+    delete entry.second;
+  }
+  for (auto& entry : m_antlrPpFileMap) {
+    delete entry.second;
+  }
+  m_antlrPpMacroMap.clear();
+  m_antlrPpFileMap.clear();
+}
+
 bool CompileSourceFile::postPreprocess_() {
   FileSystem* const fileSystem = FileSystem::getInstance();
   if (m_commandLineParser->parseOnly()) {
     m_ppResultFileId = fileSystem->copy(m_fileId, m_symbolTable);
     return true;
   }
-  std::string m_pp_result = m_pp->getPreProcessedFileContent();
+  m_ppResult = m_pp->releasePreProcessedFileContent();
   if (!m_text.empty()) {
-    m_parser = new ParseFile(m_pp_result, this, m_compilationUnit,
+    m_parser = new ParseFile(m_ppResult, this, m_compilationUnit,
                              m_library);  // unit test
   }
+  if (m_commandLineParser->lowMem() || m_commandLineParser->link()) {
+    // Nothing gets parsed in this process
+    releasePpResult();
+  }
   if (!(m_commandLineParser->writePpOutput() ||
         m_commandLineParser->writePpOutputFileId())) {
     return true;
@@ -289,16 +382,34 @@ bool CompileSourceFile::postPreprocess_() {
     return false;
   }
   if (!m_pp->usingCachedVersion() || !fileSystem->exists(m_ppResultFileId)) {
-    if (!fileSystem->writeContent(m_ppResultFileId, m_pp_result, true)) {
+    if (!fileSystem->writeContent(m_ppResultFileId, m_ppResult, true)) {
       Location loc(m_ppResultFileId);
       Error err(ErrorDefinition::PP_OPEN_FILE_FOR_WRITE, loc);
       m_errors->addError(err);
       return false;
     }
   }
+  if (m_commandLineParser->streaming()) {
+    // The parser reads the output back from the file written above
+    releasePpResult();
+  }
   return true;
 }
 
+void CompileSourceFile::releasePreprocessorState_() {
+  for (PreprocessFile* pp : m_ppIncludeVec) {
+    pp->releaseParserState();
+  }
+  for (auto& entry : m_antlrPpMacroMap) {
+    delete entry.second;
+  }
+  for (auto& entry : m_antlrPpFileMap) {
+    delete entry.second;
+  }
+  m_antlrPpMacroMap.clear();
+  m_antlrPpFileMap.clear();
+}
+
 void CompileSourceFile::registerAntlrPpHandlerForId(
     SymbolId id, PreprocessFile::AntlrParserHandler* pp) {
   auto itr = m_antlrPpMacroMap.find(id);
@@ -23,16 +23,23 @@
 
 #include "Surelog/SourceCompile/Compiler.h"
 
-#include <climits>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <mutex>
 #include <nlohmann/json.hpp>
+#include <string>
 #include <string_view>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "Surelog/API/PythonAPI.h"
@@ -43,6 +50,8 @@
 #include "Surelog/Config/ConfigSet.h"
 #include "Surelog/Design/Design.h"
 #include "Surelog/Design/FileContent.h"
+#include "Surelog/Design/ModuleInstance.h"
+#include "Surelog/Design/VObject.h"
 #include "Surelog/DesignCompile/Builtin.h"
 #include "Surelog/DesignCompile/CompileDesign.h"
 #include "Surelog/Library/Library.h"
@@ -50,12 +59,15 @@
 #include "Surelog/Library/ParseLibraryDef.h"
 #include "Surelog/Package/Precompiled.h"
 #include "Surelog/SourceCompile/AnalyzeFile.h"
+#include "Surelog/SourceCompile/AntlrParserHandler.h"
 #include "Surelog/SourceCompile/CheckCompile.h"
 #include "Surelog/SourceCompile/CompilationUnit.h"
 #include "Surelog/SourceCompile/CompileSourceFile.h"
+#include "Surelog/SourceCompile/JobCostModel.h"
 #include "Surelog/SourceCompile/ParseFile.h"
 #include "Surelog/SourceCompile/SymbolTable.h"
 #include "Surelog/Utils/ContainerUtils.h"
+#include "Surelog/Utils/MemoryUtils.h"
 #include "Surelog/Utils/StringUtils.h"
 #include "Surelog/Utils/Timer.h"
 
@@ -169,8 +181,8 @@ bool Compiler::ppinit_() {
 
   // Source files (.v, .sv on the command line)
   PathIdSet sourceFiles;
+  // All the compilers share the (thread-safe) symbol table of the compiler.
   for (const PathId& sourceFileId : m_commandLineParser->getSourceFiles()) {
-    SymbolTable* symbols = m_symbolTable;
     if (m_commandLineParser->fileunit()) {
       comp_unit = new CompilationUnit(true);
       if (m_commandLineParser->parseBuiltIn()) {
@@ -178,11 +190,9 @@ bool Compiler::ppinit_() {
         builtin->addBuiltinMacros(comp_unit);
       }
       m_compilationUnits.push_back(comp_unit);
-      symbols = m_commandLineParser->getSymbolTable()->CreateSnapshot();
-      m_symbolTables.push_back(symbols);
     }
     ErrorContainer* errors =
-        new ErrorContainer(symbols, m_errors->getLogListener());
+        new ErrorContainer(m_symbolTable, m_errors->getLogListener());
     m_errorContainers.push_back(errors);
     errors->registerCmdLine(m_commandLineParser);
 
@@ -191,7 +201,7 @@ bool Compiler::ppinit_() {
 
     CompileSourceFile* compiler =
         new CompileSourceFile(sourceFileId, m_commandLineParser, errors, this,
-                              symbols, comp_unit, library);
+                              m_symbolTable, comp_unit, library);
     m_compilers.push_back(compiler);
   }
 
@@ -258,15 +268,12 @@ bool Compiler::ppinit_() {
     }
   }
   for (const auto& libFileId : libFileIdSet) {
-    SymbolTable* symbols = m_symbolTable;
     if (m_commandLineParser->fileunit()) {
       comp_unit = new CompilationUnit(true);
       m_compilationUnits.push_back(comp_unit);
-      symbols = m_commandLineParser->getSymbolTable()->CreateSnapshot();
-      m_symbolTables.push_back(symbols);
     }
     ErrorContainer* errors =
-        new ErrorContainer(symbols, m_errors->getLogListener());
+        new ErrorContainer(m_symbolTable, m_errors->getLogListener());
     m_errorContainers.push_back(errors);
     errors->registerCmdLine(m_commandLineParser);
 
@@ -297,20 +304,18 @@ bool Compiler::ppinit_() {
         // .map files are not parsed with the regular parser
         continue;
       }
-      SymbolTable* symbols = m_symbolTable;
       if (m_commandLineParser->fileunit()) {
         comp_unit = new CompilationUnit(true);
         m_compilationUnits.push_back(comp_unit);
-        symbols = m_commandLineParser->getSymbolTable()->CreateSnapshot();
-        m_symbolTables.push_back(symbols);
       }
       ErrorContainer* errors =
-          new ErrorContainer(symbols, m_errors->getLogListener());
+          new ErrorContainer(m_symbolTable, m_errors->getLogListener());
       m_errorContainers.push_back(errors);
       errors->registerCmdLine(m_commandLineParser);
 
       CompileSourceFile* compiler = new CompileSourceFile(
-          id, m_commandLineParser, errors, this, symbols, comp_unit, &lib);
+          id, m_commandLineParser, errors, this, m_symbolTable, comp_unit,
+          &lib);
       m_compilers.push_back(compiler);
     }
   }
@@ -454,18 +459,18 @@ bool Compiler::createMultiProcessParser_() {
       m_commandLineParser->noCacheHash() ? " -nohash " : " ";
 
   // Optimize the load balance, try to even out the work in each thread by
-  // the size of the files
+  // the predicted parse cost of the files
   std::vector<std::vector<CompileSourceFile*>> jobArray(nbProcesses);
-  std::vector<uint64_t> jobSize(nbProcesses, 0);
-  size_t largestJob = 0;
+  std::vector<double> jobSize(nbProcesses, 0);
+  double largestJob = 0;
   for (const auto& compiler : m_compilers) {
-    size_t size = compiler->getJobSize(CompileSourceFile::Action::Parse);
+    const double size = predictParseCost_(compiler);
     if (size > largestJob) {
       largestJob = size;
     }
   }
 
-  uint32_t bigJobThreashold = (largestJob / nbProcesses) * 3;
+  const double bigJobThreashold = (largestJob / nbProcesses) * 3;
   std::vector<CompileSourceFile*> bigJobs;
   Precompiled* prec = Precompiled::getSingleton();
 
@@ -475,13 +480,13 @@ bool Compiler::createMultiProcessParser_() {
                                 compiler->getSymbolTable())) {
       continue;
     }
-    uint32_t size = compiler->getJobSize(CompileSourceFile::Action::Parse);
+    const double size = predictParseCost_(compiler);
     if (size > bigJobThreashold) {
       bigJobs.push_back(compiler);
       continue;
     }
     uint32_t newJobIndex = 0;
-    uint64_t minJobQueue = ULLONG_MAX;
+    double minJobQueue = std::numeric_limits<double>::max();
     for (size_t ii = 0; ii < nbProcesses; ii++) {
       if (jobSize[ii] < minJobQueue) {
         newJobIndex = ii;
@@ -755,104 +760,97 @@ static int32_t calculateEffectiveThreads(int32_t nbThreads) {
 }
 
 bool Compiler::parseinit_() {
-  Precompiled* const prec = Precompiled::getSingleton();
-
   // Single out the large files.
   // Small files are going to be scheduled in multiple threads based on size.
   // Large files are going to be compiled in a different batch in multithread
 
   if (!m_commandLineParser->fileunit()) {
-    DeleteContainerPointersAndClear(&m_symbolTables);
     DeleteContainerPointersAndClear(&m_errorContainers);
   }
 
   std::vector<CompileSourceFile*> tmp_compilers;
   for (CompileSourceFile* const compiler : m_compilers) {
-    const uint32_t nbThreads =
-        prec->isFilePrecompiled(compiler->getPpOutputFileId(),
-                                compiler->getSymbolTable())
-            ? 0
-            : m_commandLineParser->getNbMaxTreads();
-
-    const int32_t effectiveNbThreads = calculateEffectiveThreads(nbThreads);
-
-    AnalyzeFile* const fileAnalyzer = new AnalyzeFile(
-        m_commandLineParser, m_design, compiler->getPpOutputFileId(),
-        compiler->getFileId(), effectiveNbThreads, m_text);
-    fileAnalyzer->analyze();
-    compiler->setFileAnalyzer(fileAnalyzer);
-    if (fileAnalyzer->getSplitFiles().size() > 1) {
-      // Schedule parent
-      m_compilersParentFiles.push_back(compiler);
-      compiler->initParser();
-
-      if (!m_commandLineParser->fileunit()) {
-        SymbolTable* symbols =
-            m_commandLineParser->getSymbolTable()->CreateSnapshot();
-        m_symbolTables.push_back(symbols);
-        compiler->setSymbolTable(symbols);
-        // fileContent->setSymbolTable(symbols);
-        ErrorContainer* errors =
-            new ErrorContainer(symbols, m_errors->getLogListener());
-        m_errorContainers.push_back(errors);
-        errors->registerCmdLine(m_commandLineParser);
-        compiler->setErrorContainer(errors);
-      }
-
-      compiler->getParser()->setFileContent(new FileContent(
-          compiler->getParser()->getFileId(0),
-          compiler->getParser()->getLibrary(), compiler->getSymbolTable(),
-          compiler->getErrorContainer(), nullptr, BadPathId));
-
-      int32_t j = 0;
-      for (const auto& ppId : fileAnalyzer->getSplitFiles()) {
-        SymbolTable* symbols =
-            m_commandLineParser->getSymbolTable()->CreateSnapshot();
-        m_symbolTables.push_back(symbols);
-        CompileSourceFile* chunkCompiler = new CompileSourceFile(
-            compiler, ppId, fileAnalyzer->getLineOffsets()[j]);
-        // Schedule chunk
-        tmp_compilers.push_back(chunkCompiler);
-
-        chunkCompiler->setSymbolTable(symbols);
-        ErrorContainer* errors =
-            new ErrorContainer(symbols, m_errors->getLogListener());
-        m_errorContainers.push_back(errors);
-        errors->registerCmdLine(m_commandLineParser);
-        chunkCompiler->setErrorContainer(errors);
-        // chunkCompiler->getParser ()->setFileContent (fileContent);
-
-        FileContent* const chunkFileContent =
-            new FileContent(compiler->getParser()->getFileId(0),
-                            compiler->getParser()->getLibrary(), symbols,
-                            errors, nullptr, ppId);
-        chunkCompiler->getParser()->setFileContent(chunkFileContent);
-        getDesign()->addFileContent(compiler->getParser()->getFileId(0),
-                                    chunkFileContent);
-
-        j++;
-      }
-    } else {
-      if ((!m_commandLineParser->fileunit()) && m_text.empty()) {
-        SymbolTable* symbols =
-            m_commandLineParser->getSymbolTable()->CreateSnapshot();
-        m_symbolTables.push_back(symbols);
-        compiler->setSymbolTable(symbols);
-        ErrorContainer* errors =
-            new ErrorContainer(symbols, m_errors->getLogListener());
-        m_errorContainers.push_back(errors);
-        errors->registerCmdLine(m_commandLineParser);
-        compiler->setErrorContainer(errors);
-      }
-
-      tmp_compilers.push_back(compiler);
-    }
+    initParse_(compiler, &tmp_compilers);
   }
   m_compilers = tmp_compilers;
 
   return true;
 }
 
+void Compiler::initParse_(CompileSourceFile* compiler,
+                          std::vector<CompileSourceFile*>* toParse) {
+  Precompiled* const prec = Precompiled::getSingleton();
+  const uint32_t nbThreads =
+      prec->isFilePrecompiled(compiler->getPpOutputFileId(),
+                              compiler->getSymbolTable())
+          ? 0
+          : m_commandLineParser->getNbMaxTreads();
+
+  const int32_t effectiveNbThreads = calculateEffectiveThreads(nbThreads);
+
+  AnalyzeFile* const fileAnalyzer = new AnalyzeFile(
+      m_commandLineParser, m_design, compiler->getPpOutputFileId(),
+      compiler->getFileId(), effectiveNbThreads,
+      m_text.empty() ? compiler->getPpResult() : m_text);
+  fileAnalyzer->analyze();
+  compiler->setFileAnalyzer(fileAnalyzer);
+  if (fileAnalyzer->getSplitFiles().size() > 1) {
+    // The chunks are parsed from the split files
+    compiler->releasePpResult();
+    // Schedule parent
+    m_compilersParentFiles.push_back(compiler);
+    compiler->initParser();
+
+    if (!m_commandLineParser->fileunit()) {
+      ErrorContainer* errors =
+          new ErrorContainer(m_symbolTable, m_errors->getLogListener());
+      m_errorContainers.push_back(errors);
+      errors->registerCmdLine(m_commandLineParser);
+      compiler->setErrorContainer(errors);
+    }
+
+    compiler->getParser()->setFileContent(new FileContent(
+        compiler->getParser()->getFileId(0),
+        compiler->getParser()->getLibrary(), compiler->getSymbolTable(),
+        compiler->getErrorContainer(), nullptr, BadPathId));
+
+    int32_t j = 0;
+    for (const auto& ppId : fileAnalyzer->getSplitFiles()) {
+      CompileSourceFile* chunkCompiler = new CompileSourceFile(
+          compiler, ppId, fileAnalyzer->getLineOffsets()[j]);
+      // Schedule chunk
+      toParse->push_back(chunkCompiler);
+
+      ErrorContainer* errors =
+          new ErrorContainer(m_symbolTable, m_errors->getLogListener());
+      m_errorContainers.push_back(errors);
+      errors->registerCmdLine(m_commandLineParser);
+      chunkCompiler->setErrorContainer(errors);
+      // chunkCompiler->getParser ()->setFileContent (fileContent);
+
+      FileContent* const chunkFileContent =
+          new FileContent(compiler->getParser()->getFileId(0),
+                          compiler->getParser()->getLibrary(), m_symbolTable,
+                          errors, nullptr, ppId);
+      chunkCompiler->getParser()->setFileContent(chunkFileContent);
+      getDesign()->addFileContent(compiler->getParser()->getFileId(0),
+                                  chunkFileContent);
+
+      j++;
+    }
+  } else {
+    if ((!m_commandLineParser->fileunit()) && m_text.empty()) {
+      ErrorContainer* errors =
+          new ErrorContainer(m_symbolTable, m_errors->getLogListener());
+      m_errorContainers.push_back(errors);
+      errors->registerCmdLine(m_commandLineParser);
+      compiler->setErrorContainer(errors);
+    }
+
+    toParse->push_back(compiler);
+  }
+}
+
 bool Compiler::pythoninit_() { return parseinit_(); }
 
 ErrorContainer::Stats Compiler::getErrorStats() const {
@@ -867,7 +865,6 @@ ErrorContainer::Stats Compiler::getErrorStats() const {
 bool Compiler::cleanup_() {
   DeleteContainerPointersAndClear(&m_compilers);
   DeleteContainerPointersAndClear(&m_compilationUnits);
-  DeleteContainerPointersAndClear(&m_symbolTables);
   DeleteContainerPointersAndClear(&m_errorContainers);
   return true;
 }
@@ -928,15 +925,35 @@ bool Compiler::compileFileSet_(CompileSourceFile::Action action,
   } else {
     // Custom Thread management
 
+    // In link mode every job is a cache restore and no preprocessor output
+    // is written, so the file sizes cannot be used to balance the load:
+    // threads pull the jobs from a shared queue instead.
+    const bool sharedQueue = m_commandLineParser->link();
+    std::atomic<size_t> nextJob(0);
+
     // Optimize the load balance, try to even out the work in each thread by the
-    // size of the files
+    // size of the files. Parse jobs are placed longest first, by their cost
+    // predicted from the previous run.
     std::vector<std::vector<CompileSourceFile*>> jobArray(maxThreadCount);
-    std::vector<uint64_t> jobSize(maxThreadCount, 0);
+    std::vector<double> jobSize(maxThreadCount, 0);
 
+    std::vector<std::pair<double, CompileSourceFile*>> jobs;
     for (CompileSourceFile* const source : container) {
-      const uint32_t size = source->getJobSize(action);
+      if (sharedQueue) break;
+      jobs.emplace_back((action == CompileSourceFile::Parse)
+                            ? predictParseCost_(source)
+                            : (double)source->getJobSize(action),
+                        source);
+    }
+    if (action == CompileSourceFile::Parse) {
+      std::stable_sort(jobs.begin(), jobs.end(),
+                       [](const auto& lhs, const auto& rhs) {
+                         return lhs.first > rhs.first;
+                       });
+    }
+    for (const auto& [size, source] : jobs) {
       uint32_t newJobIndex = 0;
-      uint64_t minJobQueue = ULLONG_MAX;
+      double minJobQueue = std::numeric_limits<double>::max();
       for (uint16_t ii = 0; ii < maxThreadCount; ii++) {
         if (jobSize[ii] < minJobQueue) {
           newJobIndex = ii;
@@ -948,7 +965,7 @@ bool Compiler::compileFileSet_(CompileSourceFile::Action action,
       jobArray[newJobIndex].push_back(source);
     }
 
-    if (getCommandLineParser()->profile()) {
+    if (getCommandLineParser()->profile() && !sharedQueue) {
       if (action == CompileSourceFile::Preprocess)
         std::cout << "Preprocessing task" << std::endl;
       else if (action == CompileSourceFile::Parse)
@@ -975,8 +992,8 @@ bool Compiler::compileFileSet_(CompileSourceFile::Action action,
     // Create the threads with their respective workloads
     std::vector<std::thread*> threads;
     for (uint16_t i = 0; i < maxThreadCount; i++) {
-      std::thread* th = new std::thread([=] {
-        for (CompileSourceFile* job : jobArray[i]) {
+      std::thread* th = new std::thread([&, i] {
+        auto runJob = [&](CompileSourceFile* job) {
 #ifdef SURELOG_WITH_PYTHON
           if (getCommandLineParser()->pythonListener() ||
               getCommandLineParser()->pythonEvalScriptPerFile()) {
@@ -991,6 +1008,14 @@ bool Compiler::compileFileSet_(CompileSourceFile::Action action,
             job->shutdownPythonInterp();
           }
 #endif
+        };
+        if (sharedQueue) {
+          for (size_t index = nextJob++; index < container.size();
+               index = nextJob++) {
+            runJob(container[index]);
+          }
+        } else {
+          for (CompileSourceFile* job : jobArray[i]) runJob(job);
         }
       });
       threads.push_back(th);
@@ -1019,6 +1044,275 @@ bool Compiler::compileFileSet_(CompileSourceFile::Action action,
   return true;
 }
 
+bool Compiler::preprocessSharedUnit_() {
+  const uint16_t maxThreadCount = m_commandLineParser->getNbMaxTreads();
+  // Python listeners expect the files to be preprocessed in order
+  if ((maxThreadCount < 2) || (m_compilers.size() < 2) || !m_text.empty() ||
+      m_commandLineParser->pythonListener() ||
+      m_commandLineParser->pythonEvalScriptPerFile()) {
+    return compileFileSet_(CompileSourceFile::Preprocess, false, m_compilers);
+  }
+
+  // Preprocess all the files at once, each one against its own layer over
+  // the shared compilation unit. The shared unit is not modified meanwhile.
+  std::vector<uint8_t> statuses(m_compilers.size(), 0);
+  std::atomic<size_t> nextJob(0);
+  std::vector<std::thread*> threads;
+  for (uint16_t i = 0; i < maxThreadCount; i++) {
+    std::thread* th = new std::thread([&] {
+      for (size_t index = nextJob++; index < m_compilers.size();
+           index = nextJob++) {
+        CompileSourceFile* const source = m_compilers[index];
+        source->beginSpeculativePreprocess();
+        statuses[index] = source->compile(CompileSourceFile::Preprocess);
+      }
+    });
+    threads.push_back(th);
+  }
+  for (auto& t : threads) {
+    t->join();
+  }
+  DeleteContainerPointersAndClear(&threads);
+
+  // Commit in order, a file that read a macro (re)defined by one of the
+  // preceding files is preprocessed again.
+  uint32_t rerunCount = 0;
+  for (size_t index = 0; index < m_compilers.size(); ++index) {
+    CompileSourceFile* const source = m_compilers[index];
+    bool committed = false;
+    bool status = source->endSpeculativePreprocess(statuses[index] != 0,
+                                                   &committed);
+    if (committed) {
+      source->reportProcessing(CompileSourceFile::Preprocess);
+    } else {
+      ++rerunCount;
+      ErrorContainer* errors =
+          new ErrorContainer(m_symbolTable, m_errors->getLogListener());
+      m_errorContainers.push_back(errors);
+      errors->registerCmdLine(m_commandLineParser);
+      source->setErrorContainer(errors);
+      status = compileOneFile_(source, CompileSourceFile::Preprocess);
+    }
+    m_errors->appendErrors(*source->getErrorContainer());
+    m_errors->printMessages(m_commandLineParser->muteStdout());
+    if ((!status) || source->getErrorContainer()->hasFatalErrors()) {
+      // The shared unit stops at the failed file
+      for (size_t next = index + 1; next < m_compilers.size(); ++next) {
+        m_compilers[next]->discardSpeculativePreprocess();
+      }
+      return false;
+    }
+  }
+
+  if (m_commandLineParser->profile()) {
+    std::cout << "Speculative preprocessing: " << rerunCount << " of "
+              << m_compilers.size() << " files rerun" << std::endl;
+  }
+  return true;
+}
+
+bool Compiler::usePipeline_() const {
+  return m_commandLineParser->fileunit() && m_commandLineParser->parse() &&
+         (m_commandLineParser->getNbMaxTreads() > 0) &&
+         (m_commandLineParser->getNbMaxProcesses() == 0) && m_text.empty() &&
+         !m_commandLineParser->useTbb() &&
+         !m_commandLineParser->pythonListener() &&
+         !m_commandLineParser->pythonEvalScriptPerFile();
+}
+
+bool Compiler::preprocessAndParsePipelined_() {
+  const uint16_t maxThreadCount = m_commandLineParser->getNbMaxTreads();
+  const size_t fileCount = m_compilers.size();
+
+  // Guarded by "mutex". Parse jobs are run first, so that the preprocessor
+  // output is released as early as possible, the longest predicted first.
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t nextPreprocess = 0;
+  std::vector<uint8_t> preprocessed(fileCount, 0);
+  std::vector<uint8_t> statuses(fileCount, 0);
+  std::multimap<double, CompileSourceFile*, std::greater<>> parseQueue;
+  bool done = false;
+
+  std::vector<std::thread*> threads;
+  for (uint16_t i = 0; i < maxThreadCount; i++) {
+    std::thread* th = new std::thread([&] {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true) {
+        cv.wait(lock, [&] {
+          return done || !parseQueue.empty() || (nextPreprocess < fileCount);
+        });
+        if (!parseQueue.empty()) {
+          CompileSourceFile* const job = parseQueue.begin()->second;
+          parseQueue.erase(parseQueue.begin());
+          lock.unlock();
+          job->compile(CompileSourceFile::Parse);
+          lock.lock();
+        } else if (nextPreprocess < fileCount) {
+          const size_t index = nextPreprocess++;
+          lock.unlock();
+          const bool status =
+              m_compilers[index]->compile(CompileSourceFile::Preprocess);
+          lock.lock();
+          statuses[index] = status;
+          preprocessed[index] = 1;
+          cv.notify_all();
+        } else {
+          return;
+        }
+      }
+    });
+    threads.push_back(th);
+  }
+
+  // Each phase of a file reports in its own container, so that the messages
+  // are printed phase by phase as in the serial flow.
+  auto newErrorContainer = [this](CompileSourceFile* source) {
+    ErrorContainer* errors =
+        new ErrorContainer(m_symbolTable, m_errors->getLogListener());
+    m_errorContainers.push_back(errors);
+    errors->registerCmdLine(m_commandLineParser);
+    source->setErrorContainer(errors);
+    return errors;
+  };
+
+  // Post-process and analyze the files in order, the package order recorded
+  // by the analysis depends on it.
+  bool status = true;
+  size_t analyzed = 0;
+  std::vector<CompileSourceFile*> toParse;
+  std::vector<ErrorContainer*> preprocessErrors;
+  for (CompileSourceFile* const source : m_compilers) {
+    preprocessErrors.push_back(source->getErrorContainer());
+  }
+  std::vector<ErrorContainer*> postPreprocessErrors;
+  for (size_t index = 0; index < fileCount; ++index) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [&] { return preprocessed[index] != 0; });
+    }
+    CompileSourceFile* const source = m_compilers[index];
+    if ((statuses[index] == 0) || preprocessErrors[index]->hasFatalErrors()) {
+      status = false;
+      break;
+    }
+    postPreprocessErrors.push_back(newErrorContainer(source));
+    if (!compileOneFile_(source, CompileSourceFile::PostPreprocess)) {
+      status = false;
+      break;
+    }
+    // The chunks of a split file share it
+    newErrorContainer(source);
+    const size_t first = toParse.size();
+    initParse_(source, &toParse);
+    std::vector<std::pair<double, CompileSourceFile*>> jobs;
+    for (size_t i = first; i < toParse.size(); ++i) {
+      jobs.emplace_back(predictParseCost_(toParse[i]), toParse[i]);
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    parseQueue.insert(jobs.begin(), jobs.end());
+    cv.notify_all();
+    analyzed = index + 1;
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    // On failure, the files not started yet are not preprocessed
+    nextPreprocess = fileCount;
+    done = true;
+    cv.notify_all();
+  }
+  for (auto& t : threads) {
+    t->join();
+  }
+  DeleteContainerPointersAndClear(&threads);
+
+  // Promote report to master error container: all the preprocessing
+  // messages, then the post-processing ones, then the parsing ones.
+  bool fatalErrors = !status;
+  std::vector<ErrorContainer*> containers = preprocessErrors;
+  containers.insert(containers.end(), postPreprocessErrors.begin(),
+                    postPreprocessErrors.end());
+  for (CompileSourceFile* const source : toParse) {
+    containers.push_back(source->getErrorContainer());
+  }
+  for (ErrorContainer* const errors : containers) {
+    m_errors->appendErrors(*errors);
+    if (errors->hasFatalErrors()) fatalErrors = true;
+  }
+  m_errors->printMessages(m_commandLineParser->muteStdout());
+  toParse.insert(toParse.end(), m_compilers.begin() + analyzed,
+                 m_compilers.end());
+  m_compilers = toParse;
+  return !fatalErrors;
+}
+
+PathId Compiler::getParseCostsFileId_() const {
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  return fileSystem->getChild(m_commandLineParser->getCacheDirId(),
+                              "parse_costs.txt", m_symbolTable);
+}
+
+double Compiler::predictParseCost_(const CompileSourceFile* compiler) const {
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  return m_parseCosts.predict(
+      fileSystem->toPath(compiler->getPpOutputFileId()),
+      compiler->getJobSize(CompileSourceFile::Action::Parse));
+}
+
+std::string Compiler::recordParseCosts_() {
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  const bool profile = m_commandLineParser->profile();
+  std::string report;
+  if (profile) report = "Parse cost, predicted / actual:\n";
+  uint32_t fallbackCount = 0;
+  uint32_t skippedCount = 0;
+  double secondsLost = 0;
+  for (const std::vector<CompileSourceFile*>* compilers :
+       {&m_compilers, &m_compilersParentFiles}) {
+    for (const CompileSourceFile* compiler : *compilers) {
+      const std::string_view path =
+          fileSystem->toPath(compiler->getPpOutputFileId());
+      if (path.empty()) continue;
+      if (profile) {
+        report += StringUtils::to_string(predictParseCost_(compiler)) +
+                  "s / " +
+                  StringUtils::to_string(compiler->getParseSeconds()) +
+                  "s " + std::string(path) + "\n";
+      }
+      // A cache restore says nothing about the parse cost nor the prediction
+      // mode: the previous measure is kept.
+      ParseFile* const parser = compiler->getParser();
+      if ((parser == nullptr) || parser->usingCachedVersion()) continue;
+      if (parser->skippedSLL()) {
+        ++skippedCount;
+      } else if (parser->parsedInLL()) {
+        ++fallbackCount;
+        secondsLost += parser->getSLLSecondsLost();
+      }
+      m_parseCosts.record(
+          path, compiler->getJobSize(CompileSourceFile::Action::Parse),
+          compiler->getParseSeconds(), parser->parsedInLL());
+    }
+  }
+  if (profile) {
+    report += "SLL to LL fallbacks: " + std::to_string(fallbackCount) +
+              " files, " + StringUtils::to_string(secondsLost) +
+              "s lost, " + std::to_string(skippedCount) +
+              " files parsed directly in LL\n";
+  }
+  // The -mp subprocesses only parse a subset of the files, in link mode the
+  // parse is a cache restore: neither is representative.
+  if (m_commandLineParser->cacheAllowed() &&
+      !m_commandLineParser->parseOnly() && !m_commandLineParser->link() &&
+      (m_commandLineParser->getNbMaxProcesses() == 0)) {
+    const PathId cacheDirId = m_commandLineParser->getCacheDirId();
+    if (fileSystem->mkdirs(cacheDirId)) {
+      m_parseCosts.save(getParseCostsFileId_());
+    }
+  }
+  return report;
+}
+
 bool Compiler::compile() {
   FileSystem* const fileSystem = FileSystem::getInstance();
   std::string profile;
@@ -1036,24 +1330,44 @@ bool Compiler::compile() {
   }
 
   // Preprocess
+  Timer tmrLink;
   ppinit_();
+  if (m_commandLineParser->cacheAllowed()) {
+    m_parseCosts.load(getParseCostsFileId_());
+  }
   createMultiProcessPreProcessor_();
-  if (!compileFileSet_(CompileSourceFile::Preprocess,
-                       m_commandLineParser->fileunit(), m_compilers)) {
+  const bool pipelined = usePipeline_();
+  if (pipelined) {
+    // Also parses the files, but the chunks of the split ones
+    if (!preprocessAndParsePipelined_()) {
+      return false;
+    }
+  } else if (m_commandLineParser->fileunit()) {
+    if (!compileFileSet_(CompileSourceFile::Preprocess, true, m_compilers)) {
+      return false;
+    }
+  } else if (!preprocessSharedUnit_()) {
     return false;
   }
   // Single thread post Preprocess
-  if (!compileFileSet_(CompileSourceFile::PostPreprocess, false, m_compilers)) {
+  if (!pipelined &&
+      !compileFileSet_(CompileSourceFile::PostPreprocess, false, m_compilers)) {
     return false;
   }
 
   if (m_commandLineParser->profile()) {
-    std::string msg = "Preprocessing took " +
+    std::string msg = (pipelined ? "Preprocessing and parsing took "
+                                 : "Preprocessing took ") +
                       StringUtils::to_string(tmr.elapsed_rounded()) + "s\n";
     std::cout << msg << std::endl;
+    const PreprocessFile* previous = nullptr;
     for (const CompileSourceFile* compiler : m_compilers) {
-      msg += compiler->getPreprocessor()->getProfileInfo();
+      // The chunks of a split file share its preprocessor
+      PreprocessFile* const pp = compiler->getPreprocessor();
+      if (pp != previous) msg += pp->getProfileInfo();
+      previous = pp;
     }
+    msg += getMemoryProfile_();
     std::cout << msg << std::endl;
     profile += msg;
     tmr.reset();
@@ -1064,13 +1378,17 @@ bool Compiler::compile() {
   if (m_commandLineParser->parse() || m_commandLineParser->pythonListener() ||
       m_commandLineParser->pythonEvalScriptPerFile() ||
       m_commandLineParser->pythonEvalScript()) {
-    parseinit_();
-    createFileList_();
-    createMultiProcessParser_();
-    parserInitialized = true;
-    if (!compileFileSet_(CompileSourceFile::Parse, true, m_compilers)) {
-      return false;  // Small files and large file chunks
+    if (pipelined) {
+      createFileList_();
+    } else {
+      parseinit_();
+      createFileList_();
+      createMultiProcessParser_();
+      if (!compileFileSet_(CompileSourceFile::Parse, true, m_compilers)) {
+        return false;  // Small files and large file chunks
+      }
     }
+    parserInitialized = true;
     if (!compileFileSet_(CompileSourceFile::Parse, true,
                          m_compilersParentFiles)) {
       return false;  // Recombine chunks
@@ -1078,6 +1396,8 @@ bool Compiler::compile() {
   } else {
     createFileList_();
   }
+  const std::string parseCosts =
+      parserInitialized ? recordParseCosts_() : std::string();
 
   if (m_commandLineParser->profile()) {
     std::string msg =
@@ -1088,6 +1408,18 @@ bool Compiler::compile() {
     for (const CompileSourceFile* compiler : m_compilers) {
       msg += compiler->getParser()->getProfileInfo();
     }
+    msg += parseCosts;
+    if (m_commandLineParser->link()) {
+      // Preprocessing and parsing are both cache restores when linking
+      const double linkTime = tmrLink.elapsed();
+      const size_t fileCount = m_compilers.size();
+      msg += "Loading " + std::to_string(fileCount) + " unit caches took " +
+             StringUtils::to_string(tmrLink.elapsed_rounded()) + "s (" +
+             StringUtils::to_string(
+                 (linkTime > 0) ? (fileCount / linkTime) : 0.0, 1) +
+             " files/s)\n";
+    }
+    msg += getMemoryProfile_();
 
     std::cout << msg << std::endl;
     profile += msg;
@@ -1128,6 +1460,8 @@ bool Compiler::compile() {
     if (m_commandLineParser->profile()) {
       std::string msg = "Compilation took " +
                         StringUtils::to_string(tmr.elapsed_rounded()) + "s\n";
+      msg += m_compileDesign->getCompileProfile();
+      msg += getMemoryProfile_();
       std::cout << msg << std::endl;
       profile += msg;
       tmr.reset();
@@ -1142,6 +1476,7 @@ bool Compiler::compile() {
       if (m_commandLineParser->profile()) {
         std::string msg = "Elaboration took " +
                           StringUtils::to_string(tmr.elapsed_rounded()) + "s\n";
+        msg += getMemoryProfile_();
         std::cout << msg << std::endl;
         profile += msg;
         tmr.reset();
@@ -1167,6 +1502,13 @@ bool Compiler::compile() {
         m_commandLineParser->getCompileDirId(), "surelog.uhdm",
         m_compileDesign->getCompiler()->getSymbolTable());
     m_uhdmDesign = m_compileDesign->writeUHDM(uhdmFileId);
+    m_compileDesign->waitForUhdmSave();
+    if (m_commandLineParser->profile() &&
+        !m_compileDesign->getUhdmProfile().empty()) {
+      const std::string& msg = m_compileDesign->getUhdmProfile();
+      std::cout << msg << std::endl;
+      profile += msg;
+    }
     // Do not delete as now UHDM has to live past the compilation step
     // delete compileDesign;
   }
@@ -1174,15 +1516,74 @@ bool Compiler::compile() {
     std::string msg = "Total time " +
                       StringUtils::to_string(tmrTotal.elapsed_rounded()) +
                       "s\n";
+    msg += "Process peak memory " +
+           MemoryUtils::toMegaBytes(MemoryUtils::getPeakResidentBytes()) +
+           "\n";
     profile += msg;
     profile = std::string("==============\n") + "PROFILE\n" +
               std::string("==============\n") + profile + "==============\n";
     std::cout << profile << std::endl;
     m_errors->printToLogFile(profile);
+  } else if (m_commandLineParser->streaming()) {
+    const std::string msg =
+        "Process peak memory " +
+        MemoryUtils::toMegaBytes(MemoryUtils::getPeakResidentBytes()) + "\n";
+    if (!m_commandLineParser->muteStdout()) std::cout << msg << std::flush;
+    m_errors->printToLogFile(msg);
   }
   return true;
 }
 
+static void countInstances(ModuleInstance* instance, uint64_t* count) {
+  ++*count;
+  for (ModuleInstance* child : instance->getAllSubInstances()) {
+    countInstances(child, count);
+  }
+}
+
+std::string Compiler::getMemoryProfile_() {
+  uint64_t vobjectBytes = 0;
+  for (const auto& [fileId, fC] : m_design->getAllFileContents()) {
+    vobjectBytes += fC->getVObjects().capacity() * sizeof(VObject);
+  }
+  uint64_t ppVObjectBytes = 0;
+  for (const auto& [fileId, fC] : m_design->getAllPPFileContents()) {
+    ppVObjectBytes += fC->getVObjects().capacity() * sizeof(VObject);
+  }
+  uint64_t tokenBytes = 0;
+  for (const std::vector<CompileSourceFile*>* sources :
+       {&m_compilers, &m_compilersParentFiles}) {
+    for (const CompileSourceFile* source : *sources) {
+      const ParseFile* const parser = source->getParser();
+      if (parser && parser->getAntlrParserHandler()) {
+        tokenBytes += parser->getAntlrParserHandler()->getMemoryUsage();
+      }
+    }
+  }
+  uint64_t instanceCount = 0;
+  for (ModuleInstance* top : m_design->getTopLevelModuleInstances()) {
+    countInstances(top, &instanceCount);
+  }
+
+  // The high water mark only grows: if it moved since the last report, this
+  // phase reached it, otherwise the phase stayed below the earlier peak.
+  const uint64_t peak = MemoryUtils::getPeakResidentBytes();
+  const bool phasePeak = (peak > m_peakResidentBytes);
+  m_peakResidentBytes = std::max(m_peakResidentBytes, peak);
+  return StrCat(
+      "Memory: ", MemoryUtils::toMegaBytes(MemoryUtils::getResidentBytes()),
+      phasePeak ? " (phase peak " : " (below the earlier peak ",
+      MemoryUtils::toMegaBytes(peak), ")\n",
+      "  Symbol table: ",
+      MemoryUtils::toMegaBytes(m_symbolTable->getMemoryUsage()), "\n",
+      "  Parse trees: ", MemoryUtils::toMegaBytes(vobjectBytes), "\n",
+      "  Preprocessor trees: ", MemoryUtils::toMegaBytes(ppVObjectBytes), "\n",
+      "  Parser token streams: ", MemoryUtils::toMegaBytes(tokenBytes), "\n",
+      "  Module instances: ", instanceCount, " (",
+      MemoryUtils::toMegaBytes(instanceCount * sizeof(ModuleInstance)),
+      ")\n");
+}
+
 void Compiler::registerAntlrPpHandlerForId(
     SymbolId id, PreprocessFile::AntlrParserHandler* pp) {
   std::map<SymbolId, PreprocessFile::AntlrParserHandler*>::iterator itr =
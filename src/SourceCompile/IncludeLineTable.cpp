@@ -0,0 +1,113 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/SourceCompile/IncludeLineTable.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Surelog/SourceCompile/IncludeFileInfo.h"
+
+namespace SURELOG {
+
+void IncludeLineTable::build(const std::vector<IncludeFileInfo>& infos,
+                             uint32_t lineCount) {
+  m_intervals.clear();
+  m_lineCount = lineCount;
+  // Line 0 is not a line of the file, it reports line 1
+  m_intervals.push_back({0, false, BadPathId, 1});
+
+  // A line belongs to the last section (in the order of "infos") covering it:
+  // a POP covers the lines from its start on, a PUSH the lines up to its POP.
+  // Sweep the section boundaries, <line, index + 1> opens a section and
+  // <line, -(index + 1)> closes it.
+  const int32_t count = static_cast<int32_t>(infos.size());
+  std::vector<std::pair<uint32_t, int32_t>> events;
+  events.reserve(2 * infos.size() + 1);
+  events.emplace_back(1, 0);
+  for (int32_t i = 0; i < count; ++i) {
+    const IncludeFileInfo& info = infos[i];
+    const uint32_t start = std::max(info.m_originalStartLine, 1U);
+    if (info.m_action == IncludeFileInfo::Action::POP) {
+      events.emplace_back(start, i + 1);
+    } else if ((info.m_action == IncludeFileInfo::Action::PUSH) &&
+               (info.m_indexClosing > -1) && (info.m_indexClosing < count)) {
+      const uint32_t end = infos[info.m_indexClosing].m_originalStartLine;
+      if (start < end) {
+        events.emplace_back(start, i + 1);
+        events.emplace_back(end, -(i + 1));
+      }
+    }
+  }
+  std::sort(events.begin(), events.end());
+
+  std::set<int32_t> covering;
+  for (size_t i = 0, n = events.size(); i < n;) {
+    const uint32_t line = events[i].first;
+    for (; (i < n) && (events[i].first == line); ++i) {
+      const int32_t event = events[i].second;
+      if (event > 0) {
+        covering.insert(event - 1);
+      } else if (event < 0) {
+        covering.erase(-event - 1);
+      }
+    }
+    Interval interval{line, false, BadPathId, 0};
+    if (!covering.empty()) {
+      interval.m_inSection = true;
+      const IncludeFileInfo& info = infos[*covering.rbegin()];
+      interval.m_fileId = info.m_sectionFileId;
+      interval.m_lineOffset = (int64_t)info.m_sectionStartLine -
+                              (int64_t)info.m_originalStartLine;
+    }
+    const Interval& last = m_intervals.back();
+    if ((last.m_inSection == interval.m_inSection) &&
+        (last.m_fileId == interval.m_fileId) &&
+        (last.m_lineOffset == interval.m_lineOffset)) {
+      continue;
+    }
+    m_intervals.emplace_back(interval);
+  }
+}
+
+const IncludeLineTable::Interval& IncludeLineTable::find(
+    uint32_t ppLine, uint32_t* hint) const {
+  const uint32_t size = static_cast<uint32_t>(m_intervals.size());
+  // Same interval as the last lookup, or the next one
+  for (uint32_t index = *hint; (index < size) && (index < *hint + 2);
+       ++index) {
+    if (ppLine < m_intervals[index].m_ppStartLine) break;
+    if ((index + 1 == size) ||
+        (ppLine < m_intervals[index + 1].m_ppStartLine)) {
+      *hint = index;
+      return m_intervals[index];
+    }
+  }
+  std::vector<Interval>::const_iterator itr = std::upper_bound(
+      m_intervals.begin(), m_intervals.end(), ppLine,
+      [](uint32_t line, const Interval& interval) {
+        return line < interval.m_ppStartLine;
+      });
+  // The first interval starts at line 0
+  --itr;
+  *hint = static_cast<uint32_t>(itr - m_intervals.begin());
+  return *itr;
+}
+
+}  // namespace SURELOG
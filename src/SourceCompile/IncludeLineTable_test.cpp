@@ -0,0 +1,95 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/SourceCompile/IncludeLineTable.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "Surelog/SourceCompile/IncludeFileInfo.h"
+
+namespace SURELOG {
+
+namespace {
+using Action = IncludeFileInfo::Action;
+using Context = IncludeFileInfo::Context;
+
+// Original line of "ppLine" as the former dense per-line cache computed it:
+// the last section, in the info order, covering the line.
+int64_t referenceLine(const std::vector<IncludeFileInfo>& infos,
+                      uint32_t ppLine, RawPathId* fileId) {
+  *fileId = BadRawPathId;
+  if (ppLine == 0) return 1;
+  for (int32_t index = infos.size() - 1; index >= 0; --index) {
+    const IncludeFileInfo& info = infos[index];
+    if (ppLine < info.m_originalStartLine) continue;
+    if ((info.m_action == Action::POP) ||
+        ((info.m_action == Action::PUSH) && (info.m_indexClosing > -1) &&
+         (ppLine < infos[info.m_indexClosing].m_originalStartLine))) {
+      *fileId = (RawPathId)info.m_sectionFileId;
+      return info.m_sectionStartLine + (ppLine - info.m_originalStartLine);
+    }
+  }
+  return ppLine;
+}
+
+IncludeFileInfo makeInfo(RawPathId fileId, uint32_t sectionStartLine,
+                         uint32_t originalStartLine, Action action,
+                         int32_t indexOpening, int32_t indexClosing) {
+  return IncludeFileInfo(Context::INCLUDE, sectionStartLine, BadSymbolId,
+                         PathId(nullptr, fileId, "file"), originalStartLine, 0,
+                         0, 0, action, indexOpening, indexClosing);
+}
+
+TEST(IncludeLineTableTest, NestedIncludes) {
+  // top.sv (1) includes a.svh at line 5, a.svh includes b.svh at its line 3.
+  // The include of c.svh at line 30 is never popped, it covers no line.
+  std::vector<IncludeFileInfo> infos;
+  infos.emplace_back(makeInfo(1, 0, 0, Action::POP, 0, 0));
+  infos.emplace_back(makeInfo(2, 1, 5, Action::PUSH, 1, 4));
+  infos.emplace_back(makeInfo(3, 1, 7, Action::PUSH, 2, 3));
+  infos.emplace_back(makeInfo(2, 4, 12, Action::POP, 2, 3));
+  infos.emplace_back(makeInfo(1, 6, 20, Action::POP, 1, 4));
+  infos.emplace_back(makeInfo(4, 1, 30, Action::PUSH, 5, -1));
+
+  IncludeLineTable table;
+  table.build(infos, 50);
+  EXPECT_EQ(table.getLineCount(), 50);
+  // One interval per section boundary, plus line 0
+  EXPECT_EQ(table.getIntervals().size(), 6);
+
+  uint32_t hint = 0;
+  for (uint32_t line = 0; line < table.getLineCount(); ++line) {
+    RawPathId fileId = BadRawPathId;
+    const int64_t expected = referenceLine(infos, line, &fileId);
+    const IncludeLineTable::Interval& interval = table.find(line, &hint);
+    EXPECT_EQ(line + interval.m_lineOffset, expected) << line;
+    EXPECT_EQ(interval.m_inSection ? (RawPathId)interval.m_fileId
+                                   : BadRawPathId,
+              fileId)
+        << line;
+  }
+
+  // Random access, away from the hint
+  hint = 0;
+  EXPECT_EQ(table.find(25, &hint).m_lineOffset, 6 - 20);
+  EXPECT_EQ(table.find(8, &hint).m_lineOffset, 1 - 7);
+  EXPECT_EQ((RawPathId)table.find(8, &hint).m_fileId, 3);
+}
+}  // namespace
+}  // namespace SURELOG
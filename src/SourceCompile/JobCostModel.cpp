@@ -0,0 +1,132 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/SourceCompile/JobCostModel.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "Surelog/Common/FileSystem.h"
+#include "Surelog/Utils/StringUtils.h"
+
+namespace SURELOG {
+
+// Rate assumed when nothing is known, only the relative order matters then.
+static constexpr double kDefaultSecondsPerByte = 1.0e-6;
+
+bool JobCostModel::load(PathId fileId) {
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  std::string text;
+  if (!fileSystem->exists(fileId) || !fileSystem->readContent(fileId, text)) {
+    return false;
+  }
+  deserialize(text);
+  return true;
+}
+
+bool JobCostModel::save(PathId fileId) const {
+  FileSystem* const fileSystem = FileSystem::getInstance();
+  return fileSystem->writeContent(fileId, serialize(), false);
+}
+
+void JobCostModel::deserialize(std::string_view text) {
+  m_history.clear();
+  double totalSeconds = 0;
+  uint64_t totalBytes = 0;
+  for (std::string_view line : StringUtils::splitLines(text)) {
+    line = StringUtils::rtrim(line);
+    const size_t first = line.find(' ');
+    const size_t second = line.find(' ', first + 1);
+    const size_t third = line.find(' ', second + 1);
+    if ((first == std::string_view::npos) ||
+        (second == std::string_view::npos) ||
+        (third == std::string_view::npos)) {
+      continue;
+    }
+    const std::string seconds(line.substr(0, first));
+    const std::string bytes(line.substr(first + 1, second - first - 1));
+    Cost cost;
+    cost.m_seconds = std::strtod(seconds.c_str(), nullptr);
+    cost.m_bytes = std::strtoull(bytes.c_str(), nullptr, 10);
+    const std::string llRuns(line.substr(second + 1, third - second - 1));
+    cost.m_llRuns = std::strtoul(llRuns.c_str(), nullptr, 10);
+    m_history[std::string(line.substr(third + 1))] = cost;
+    totalSeconds += cost.m_seconds;
+    totalBytes += cost.m_bytes;
+  }
+  m_secondsPerByte =
+      (totalBytes != 0) ? (totalSeconds / totalBytes) : kDefaultSecondsPerByte;
+}
+
+std::string JobCostModel::serialize() const {
+  // The files not parsed in this run keep their previous cost
+  CostMap costs = m_history;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [path, cost] : m_measured) costs[path] = cost;
+  }
+  std::ostringstream out;
+  out.precision(6);
+  for (const auto& [path, cost] : costs) {
+    out << std::fixed << cost.m_seconds << " " << cost.m_bytes << " "
+        << cost.m_llRuns << " " << path << "\n";
+  }
+  return out.str();
+}
+
+double JobCostModel::predict(std::string_view path, uint64_t bytes) const {
+  CostMap::const_iterator itr = m_history.find(path);
+  if (itr == m_history.end()) {
+    const double rate =
+        (m_secondsPerByte != 0) ? m_secondsPerByte : kDefaultSecondsPerByte;
+    return rate * bytes;
+  }
+  const Cost& cost = itr->second;
+  // Scale with the size of an edited file
+  if ((cost.m_bytes != 0) && (bytes != 0)) {
+    return cost.m_seconds * bytes / cost.m_bytes;
+  }
+  return cost.m_seconds;
+}
+
+bool JobCostModel::needsLL(std::string_view path, uint64_t bytes) const {
+  CostMap::const_iterator itr = m_history.find(path);
+  if (itr == m_history.end()) return false;
+  const Cost& cost = itr->second;
+  return (cost.m_bytes == bytes) && (cost.m_llRuns != 0) &&
+         ((cost.m_llRuns % kLLRetryPeriod) != 0);
+}
+
+void JobCostModel::record(std::string_view path, uint64_t bytes,
+                          double seconds, bool parsedInLL) {
+  uint32_t llRuns = 0;
+  if (parsedInLL) {
+    // A skipped SLL attempt extends the streak, a failed one restarts it
+    llRuns = 1;
+    if (needsLL(path, bytes)) llRuns += m_history.find(path)->second.m_llRuns;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Cost& cost = m_measured[std::string(path)];
+  cost.m_bytes = bytes;
+  cost.m_seconds = seconds;
+  cost.m_llRuns = llRuns;
+}
+
+}  // namespace SURELOG
@@ -0,0 +1,101 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/SourceCompile/JobCostModel.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace SURELOG {
+
+namespace {
+TEST(JobCostModelTest, PredictFromHistory) {
+  JobCostModel model;
+  EXPECT_FALSE(model.hasHistory());
+  // Without history, the cost is proportional to the size.
+  EXPECT_GT(model.predict("a.sv", 2000), model.predict("b.sv", 1000));
+
+  model.deserialize(
+      "2.000000 1000 1 dir/slow.sv\n"
+      "0.500000 1000 0 dir/fast.sv\n"
+      "garbage\n");
+  EXPECT_TRUE(model.hasHistory());
+  EXPECT_DOUBLE_EQ(model.predict("dir/slow.sv", 1000), 2.0);
+  EXPECT_DOUBLE_EQ(model.predict("dir/fast.sv", 1000), 0.5);
+  // An edited file scales with its new size.
+  EXPECT_DOUBLE_EQ(model.predict("dir/fast.sv", 2000), 1.0);
+  // A new file is estimated at the average rate.
+  EXPECT_DOUBLE_EQ(model.predict("dir/new.sv", 400), 0.5);
+  EXPECT_TRUE(model.needsLL("dir/slow.sv", 1000));
+  EXPECT_FALSE(model.needsLL("dir/fast.sv", 1000));
+  EXPECT_FALSE(model.needsLL("dir/new.sv", 1000));
+  // SLL is retried on an edited file.
+  EXPECT_FALSE(model.needsLL("dir/slow.sv", 1001));
+}
+
+TEST(JobCostModelTest, RecordAndSerialize) {
+  JobCostModel model;
+  model.deserialize("1.000000 10 1 kept.sv\n3.000000 30 0 updated.sv\n");
+  model.record("updated.sv", 60, 4.0, true);
+  model.record("with space.sv", 5, 0.25, false);
+  // Recording does not change the predictions of the current run.
+  EXPECT_DOUBLE_EQ(model.predict("updated.sv", 30), 3.0);
+
+  JobCostModel next;
+  next.deserialize(model.serialize());
+  EXPECT_DOUBLE_EQ(next.predict("kept.sv", 10), 1.0);
+  EXPECT_DOUBLE_EQ(next.predict("updated.sv", 60), 4.0);
+  EXPECT_DOUBLE_EQ(next.predict("with space.sv", 5), 0.25);
+  EXPECT_TRUE(next.needsLL("kept.sv", 10));
+  EXPECT_TRUE(next.needsLL("updated.sv", 60));
+  EXPECT_FALSE(next.needsLL("with space.sv", 5));
+}
+
+TEST(JobCostModelTest, RetrySLLPeriodically) {
+  std::string state;
+  {
+    JobCostModel model;
+    model.record("a.sv", 10, 1.0, true);
+    state = model.serialize();
+  }
+  // Parsed directly in LL until the SLL retry is due.
+  uint32_t llRuns = 1;
+  for (;;) {
+    JobCostModel model;
+    model.deserialize(state);
+    if (!model.needsLL("a.sv", 10)) break;
+    model.record("a.sv", 10, 1.0, true);
+    state = model.serialize();
+    ASSERT_LT(++llRuns, 100u);
+  }
+  EXPECT_GT(llRuns, 1u);
+  // A failed SLL retry sets the flag again, a successful one clears it.
+  JobCostModel failed;
+  failed.deserialize(state);
+  failed.record("a.sv", 10, 1.0, true);
+  JobCostModel afterFailure;
+  afterFailure.deserialize(failed.serialize());
+  EXPECT_TRUE(afterFailure.needsLL("a.sv", 10));
+  JobCostModel succeeded;
+  succeeded.deserialize(state);
+  succeeded.record("a.sv", 10, 0.5, false);
+  JobCostModel afterSuccess;
+  afterSuccess.deserialize(succeeded.serialize());
+  EXPECT_FALSE(afterSuccess.needsLL("a.sv", 10));
+}
+}  // namespace
+}  // namespace SURELOG
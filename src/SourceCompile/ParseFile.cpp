@@ -45,7 +45,10 @@
 #include "Surelog/SourceCompile/AntlrParserErrorListener.h"
 #include "Surelog/SourceCompile/AntlrParserHandler.h"
 #include "Surelog/SourceCompile/CompileSourceFile.h"
+#include "Surelog/SourceCompile/Compiler.h"
 #include "Surelog/SourceCompile/IncludeFileInfo.h"
+#include "Surelog/SourceCompile/IncludeLineTable.h"
+#include "Surelog/SourceCompile/JobCostModel.h"
 #include "Surelog/SourceCompile/SV3_1aTreeShapeListener.h"
 #include "Surelog/SourceCompile/SymbolTable.h"
 #include "Surelog/Utils/StringUtils.h"
@@ -138,6 +141,14 @@ ParseFile::~ParseFile() {
   delete m_listener;
 }
 
+void ParseFile::releaseParserHandler_() {
+  if (m_keepParserHandler) return;
+  delete m_listener;
+  m_listener = nullptr;
+  delete m_antlrParserHandler;
+  m_antlrParserHandler = nullptr;
+}
+
 SymbolTable* ParseFile::getSymbolTable() {
   return m_symbolTable ? m_symbolTable : m_compileSourceFile->getSymbolTable();
 }
@@ -162,57 +173,21 @@ void ParseFile::addError(Error& error) {
   getCompileSourceFile()->getErrorContainer()->addError(error);
 }
 
-void ParseFile::buildLineInfoCache_() {
-  PreprocessFile* pp = getCompileSourceFile()->getPreprocessor();
-  if (!pp) return;
-  auto const& infos = pp->getIncludeFileInfo();
-  if (!infos.empty()) {
-    fileInfoCache.resize(pp->getSumLineCount() + 10);
-    lineInfoCache.resize(pp->getSumLineCount() + 10);
-    lineInfoCache[0] = 1;
-    fileInfoCache[0] = m_fileId;
-    for (uint32_t lineItr = 1; lineItr < pp->getSumLineCount() + 10;
-         lineItr++) {
-      fileInfoCache[lineItr] = m_fileId;
-      lineInfoCache[lineItr] = lineItr;
-      bool inRange = false;
-      uint32_t indexOpeningRange = 0;
-      uint32_t index = infos.size() - 1;
-      while (true) {
-        if ((lineItr >= infos[index].m_originalStartLine) &&
-            (infos[index].m_action == IncludeFileInfo::Action::POP)) {
-          fileInfoCache[lineItr] = infos[index].m_sectionFileId;
-          uint32_t l = infos[index].m_sectionStartLine +
-                       (lineItr - infos[index].m_originalStartLine);
-          lineInfoCache[lineItr] = l;
-          break;
-        }
-        if (infos[index].m_action == IncludeFileInfo::Action::POP) {
-          if (!inRange) {
-            inRange = true;
-            indexOpeningRange = infos[index].m_indexOpening;
-          }
-        } else {
-          if (inRange) {
-            if (index == indexOpeningRange) inRange = false;
-          }
-        }
-        if ((lineItr >= infos[index].m_originalStartLine) &&
-            (infos[index].m_action == IncludeFileInfo::Action::PUSH) &&
-            (infos[index].m_indexClosing > -1) &&
-            (lineItr <
-             infos[infos[index].m_indexClosing].m_originalStartLine)) {
-          fileInfoCache[lineItr] = infos[index].m_sectionFileId;
-          uint32_t l = infos[index].m_sectionStartLine +
-                       (lineItr - infos[index].m_originalStartLine);
-          lineInfoCache[lineItr] = l;
-          break;
-        }
-        if (index == 0) break;
-        index--;
-      }
-    }
+void ParseFile::translateLine_(PreprocessFile* pp, uint32_t line,
+                               PathId* fileId, uint32_t* lineNb) {
+  if (pp->getIncludeFileInfo().empty()) return;
+  const IncludeLineTable& table = pp->getIncludeLineTable();
+  if (line >= table.getLineCount()) {
+    SymbolId symbolId = registerSymbol("CACHE OUT OF BOUND");
+    Location ppfile(symbolId);
+    Error err(ErrorDefinition::PA_INTERNAL_WARNING, ppfile);
+    addError(err);
+    return;
   }
+  const IncludeLineTable::Interval& interval =
+      table.find(line, &m_includeLineHint);
+  if (interval.m_inSection) *fileId = interval.m_fileId;
+  *lineNb = static_cast<uint32_t>(line + interval.m_lineOffset);
 }
 
 PathId ParseFile::getFileId(uint32_t line) {
@@ -221,60 +196,20 @@ PathId ParseFile::getFileId(uint32_t line) {
   }
   PreprocessFile* pp = getCompileSourceFile()->getPreprocessor();
   if (!pp) return BadPathId;
-  auto& infos = pp->getIncludeFileInfo();
-  if (!infos.empty()) {
-    if (!fileInfoCache.empty()) {
-      if (line > fileInfoCache.size()) {
-        SymbolId fileId = registerSymbol("CACHE OUT OF BOUND");
-        Location ppfile(fileId);
-        Error err(ErrorDefinition::PA_INTERNAL_WARNING, ppfile);
-        addError(err);
-        return m_fileId;
-      }
-      return fileInfoCache[line];
-    }
-    buildLineInfoCache_();
-    if (line > fileInfoCache.size()) {
-      SymbolId fileId = registerSymbol("CACHE OUT OF BOUND");
-      Location ppfile(fileId);
-      Error err(ErrorDefinition::PA_INTERNAL_WARNING, ppfile);
-      addError(err);
-      return m_fileId;
-    }
-    return fileInfoCache[line];
-  } else {
-    return m_fileId;
-  }
+  PathId fileId = m_fileId;
+  uint32_t lineNb = line;
+  translateLine_(pp, line, &fileId, &lineNb);
+  return fileId;
 }
 
 uint32_t ParseFile::getLineNb(uint32_t line) {
   if (!getCompileSourceFile()) return line;
   PreprocessFile* pp = getCompileSourceFile()->getPreprocessor();
   if (!pp) return 0;
-  auto& infos = pp->getIncludeFileInfo();
-  if (!infos.empty()) {
-    if (!lineInfoCache.empty()) {
-      if (line > lineInfoCache.size()) {
-        SymbolId fileId = registerSymbol("CACHE OUT OF BOUND");
-        Location ppfile(fileId);
-        Error err(ErrorDefinition::PA_INTERNAL_WARNING, ppfile);
-        addError(err);
-        return line;
-      }
-      return lineInfoCache[line];
-    }
-    buildLineInfoCache_();
-    if (line > lineInfoCache.size()) {
-      SymbolId fileId = registerSymbol("CACHE OUT OF BOUND");
-      Location ppfile(fileId);
-      Error err(ErrorDefinition::PA_INTERNAL_WARNING, ppfile);
-      addError(err);
-      return line;
-    }
-    return lineInfoCache[line];
-  } else {
-    return line;
-  }
+  PathId fileId = m_fileId;
+  uint32_t lineNb = line;
+  translateLine_(pp, line, &fileId, &lineNb);
+  return lineNb;
 }
 
 bool ParseFile::parseOneFile_(PathId fileId, uint32_t lineOffset) {
@@ -284,7 +219,17 @@ bool ParseFile::parseOneFile_(PathId fileId, uint32_t lineOffset) {
   Timer tmr;
   m_antlrParserHandler = new AntlrParserHandler();
   m_antlrParserHandler->m_clearAntlrCache = clp->lowMem();
-  if (m_sourceText.empty()) {
+  // The preprocessor output is still in memory unless this is a chunk of a
+  // split file, the file on disk is only read as a fallback.
+  const std::string ppResult =
+      (m_parent == nullptr) ? getCompileSourceFile()->releasePpResult() : "";
+  if (!m_sourceText.empty()) {
+    m_antlrParserHandler->m_inputStream =
+        new antlr4::ANTLRInputStream(m_sourceText);
+  } else if (!ppResult.empty()) {
+    m_antlrParserHandler->m_inputStream =
+        new antlr4::ANTLRInputStream(ppResult);
+  } else {
     std::istream& stream = fileSystem->openForRead(fileId);
     if (!stream.good()) {
       Location ppfile(fileId);
@@ -294,9 +239,6 @@ bool ParseFile::parseOneFile_(PathId fileId, uint32_t lineOffset) {
     }
     m_antlrParserHandler->m_inputStream = new antlr4::ANTLRInputStream(stream);
     fileSystem->close(stream);
-  } else {
-    m_antlrParserHandler->m_inputStream =
-        new antlr4::ANTLRInputStream(m_sourceText);
   }
 
   m_antlrParserHandler->m_errorListener = new AntlrParserErrorListener(
@@ -368,13 +310,50 @@ bool ParseFile::parseOneFile_(PathId fileId, uint32_t lineOffset) {
   if (getCompileSourceFile()->getCommandLineParser()->profile()) {
     m_antlrParserHandler->m_parser->setProfile(true);
   }
+
+  // Full LL parse, reporting the syntax errors
+  auto parseLL = [&]() {
+    m_parsedInLL = true;
+    m_antlrParserHandler->m_parser->setErrorHandler(
+        std::make_shared<antlr4::DefaultErrorStrategy>());
+    m_antlrParserHandler->m_parser->addErrorListener(
+        m_antlrParserHandler->m_errorListener);
+    m_antlrParserHandler->m_parser
+        ->getInterpreter<antlr4::atn::ParserATNSimulator>()
+        ->setPredictionMode(antlr4::atn::PredictionMode::LL);
+    m_antlrParserHandler->m_tree =
+        m_antlrParserHandler->m_parser->top_level_rule();
+
+    if (getCompileSourceFile()->getCommandLineParser()->profile()) {
+      StrAppend(&m_profileInfo,
+                "LL  Parsing: ", StringUtils::to_string(tmr.elapsed_rounded()),
+                "s ", fileSystem->toPath(fileId), "\n");
+      tmr.reset();
+      profileParser();
+    }
+  };
+
+  m_antlrParserHandler->m_parser->removeErrorListeners();
+  // The unchanged files the SLL prediction recently failed on go straight to
+  // LL, instead of paying for a doomed SLL attempt first.
+  const CompileSourceFile* const csf = getCompileSourceFile();
+  const Compiler* const compiler = csf->getCompiler();
+  if (m_sourceText.empty() && (compiler != nullptr) &&
+      compiler->getParseCosts().needsLL(
+          fileSystem->toPath(fileId),
+          csf->getJobSize(CompileSourceFile::Action::Parse))) {
+    m_skippedSLL = true;
+    parseLL();
+    return true;
+  }
+
   m_antlrParserHandler->m_parser
       ->getInterpreter<antlr4::atn::ParserATNSimulator>()
       ->setPredictionMode(antlr4::atn::PredictionMode::SLL);
-  m_antlrParserHandler->m_parser->removeErrorListeners();
   m_antlrParserHandler->m_parser->setErrorHandler(
       std::make_shared<antlr4::BailErrorStrategy>());
 
+  Timer sllTimer;
   try {
     m_antlrParserHandler->m_tree =
         m_antlrParserHandler->m_parser->top_level_rule();
@@ -387,29 +366,14 @@ bool ParseFile::parseOneFile_(PathId fileId, uint32_t lineOffset) {
       profileParser();
     }
   } catch (antlr4::ParseCancellationException& pex) {
+    m_sllSecondsLost = sllTimer.elapsed();
     m_antlrParserHandler->m_tokens->reset();
     m_antlrParserHandler->m_parser->reset();
     m_antlrParserHandler->m_parser->removeErrorListeners();
     if (getCompileSourceFile()->getCommandLineParser()->profile()) {
       m_antlrParserHandler->m_parser->setProfile(true);
     }
-    m_antlrParserHandler->m_parser->setErrorHandler(
-        std::make_shared<antlr4::DefaultErrorStrategy>());
-    m_antlrParserHandler->m_parser->addErrorListener(
-        m_antlrParserHandler->m_errorListener);
-    m_antlrParserHandler->m_parser
-        ->getInterpreter<antlr4::atn::ParserATNSimulator>()
-        ->setPredictionMode(antlr4::atn::PredictionMode::LL);
-    m_antlrParserHandler->m_tree =
-        m_antlrParserHandler->m_parser->top_level_rule();
-
-    if (getCompileSourceFile()->getCommandLineParser()->profile()) {
-      StrAppend(&m_profileInfo,
-                "LL  Parsing: ", StringUtils::to_string(tmr.elapsed_rounded()),
-                "s ", fileSystem->toPath(fileId), "\n");
-      tmr.reset();
-      profileParser();
-    }
+    parseLL();
   }
   /* Failed attempt to minimize memory usage:
      m_antlrParserHandler->m_parser->getInterpreter<antlr4::atn::ParserATNSimulator>()->clearDFA();
@@ -528,6 +492,7 @@ bool ParseFile::parse() {
 
       if (debug_AstModel && !precompiled)
         std::cout << m_fileContent->printObjects();
+      releaseParserHandler_();
 
       if (clp->profile()) {
         // m_profileInfo += "AST Walking: " + std::to_string
@@ -574,6 +539,7 @@ bool ParseFile::parse() {
 
           if (debug_AstModel && !precompiled)
             std::cout << child->m_fileContent->printObjects();
+          child->releaseParserHandler_();
 
           ParseCache cache(child);
           if (clp->link()) return true;
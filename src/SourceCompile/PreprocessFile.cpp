@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <functional>
 #include <iostream>
+#include <mutex>
 #include <regex>
 #include <set>
 #include <string_view>
@@ -595,6 +596,13 @@ void PreprocessFile::resetIncludeFileInfo() {
 
 void PreprocessFile::clearIncludeFileInfo() { m_includeFileInfo.clear(); }
 
+const IncludeLineTable& PreprocessFile::getIncludeLineTable() {
+  std::call_once(m_includeLineTableBuilt, [this]() {
+    m_includeLineTable.build(m_includeFileInfo, getSumLineCount() + 10);
+  });
+  return m_includeLineTable;
+}
+
 void PreprocessFile::append(std::string_view s) {
   if (!m_pauseAppend) {
     m_lineCount += LinesCount(s);
@@ -1235,6 +1243,18 @@ uint32_t PreprocessFile::getLineNb(uint32_t line) {
 }
 
 std::string PreprocessFile::getPreProcessedFileContent() {
+  finalizeResult_();
+  return m_result;
+}
+
+std::string PreprocessFile::releasePreProcessedFileContent() {
+  finalizeResult_();
+  std::string result;
+  result.swap(m_result);
+  return result;
+}
+
+void PreprocessFile::finalizeResult_() {
   FileSystem* const fileSystem = FileSystem::getInstance();
   // If File is empty (Only CR) return an empty string
   bool nonEmpty = false;
@@ -1256,7 +1276,13 @@ std::string PreprocessFile::getPreProcessedFileContent() {
               << m_result << "\n^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^\n"
               << std::endl;
   }
-  return m_result;
+}
+
+void PreprocessFile::releaseParserState() {
+  delete m_listener;
+  m_listener = nullptr;
+  m_antlrParserHandler = nullptr;
+  std::string().swap(m_result);
 }
 
 PreprocessFile::IfElseStack& PreprocessFile::getStack() {
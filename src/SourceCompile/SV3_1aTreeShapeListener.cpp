@@ -23,8 +23,9 @@
 
 #include "Surelog/SourceCompile/SV3_1aTreeShapeListener.h"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <regex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -90,7 +91,7 @@ void SV3_1aTreeShapeListener::enterModule_declaration(
     else
       ident = "MODULE NAME UNKNOWN";
   }
-  ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+  StringUtils::eraseAll(&ident, EscapeSequence);
   addNestedDesignElement(ctx, ident, DesignElement::Module,
                          VObjectType::paMODULE);
 }
@@ -262,7 +263,7 @@ void SV3_1aTreeShapeListener::enterInterface_declaration(
                  VObjectType::paINTERFACE);
     }
   }
-  ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+  StringUtils::eraseAll(&ident, EscapeSequence);
   addNestedDesignElement(ctx, ident, DesignElement::Interface,
                          VObjectType::paINTERFACE);
 }
@@ -632,7 +633,7 @@ void SV3_1aTreeShapeListener::enterProgram_declaration(
                  VObjectType::paPROGRAM);
     }
   }
-  ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+  StringUtils::eraseAll(&ident, EscapeSequence);
   addDesignElement(ctx, ident, DesignElement::Program, VObjectType::paPROGRAM);
 }
 
@@ -641,7 +642,7 @@ void SV3_1aTreeShapeListener::enterClass_declaration(
   std::string ident;
   if (ctx->identifier(0)) {
     ident = ctx->identifier(0)->getText();
-    ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+    StringUtils::eraseAll(&ident, EscapeSequence);
     addDesignElement(ctx, ident, DesignElement::Class, VObjectType::paCLASS);
   } else
     addDesignElement(ctx, "UNNAMED_CLASS", DesignElement::Class,
@@ -661,7 +662,7 @@ void SV3_1aTreeShapeListener::enterPackage_declaration(
                VObjectType::paPACKAGE);
   }
   std::string ident = ctx->identifier(0)->getText();
-  ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+  StringUtils::eraseAll(&ident, EscapeSequence);
   addDesignElement(ctx, ident, DesignElement::Package, VObjectType::paPACKAGE);
 }
 
@@ -675,6 +676,30 @@ void SV3_1aTreeShapeListener::enterTimeUnitsDecl_TimeUnit(
   }
 }
 
+// Splits "`timescale<value><unit>/<value><unit>", as returned by getText()
+// (spaces dropped), into these 4 fields. Returns false if it does not match.
+static bool splitTimescale(std::string_view text,
+                           std::array<std::string_view, 4> *fields) {
+  static constexpr std::string_view kTimescale = "`timescale";
+  if (text.substr(0, kTimescale.length()) != kTimescale) return false;
+  size_t pos = kTimescale.length();
+  for (size_t i = 0; i < fields->size(); ++i) {
+    if (i == 2) {
+      if ((pos == text.length()) || (text[pos] != '/')) return false;
+      ++pos;
+    }
+    const std::string_view charset = (i % 2 == 0) ? "0123456789" : "mnsupf";
+    const size_t start = pos;
+    while ((pos < text.length()) &&
+           (charset.find(text[pos]) != std::string_view::npos)) {
+      ++pos;
+    }
+    if (pos == start) return false;
+    (*fields)[i] = text.substr(start, pos - start);
+  }
+  return pos == text.length();
+}
+
 void SV3_1aTreeShapeListener::enterTimescale_directive(
     SV3_1aParser::Timescale_directiveContext *ctx) {
   TimeInfo compUnitTimeInfo;
@@ -683,21 +708,18 @@ void SV3_1aTreeShapeListener::enterTimescale_directive(
   ParseUtils::LineColumn lineCol =
       ParseUtils::getLineColumn(ctx->TICK_TIMESCALE());
   compUnitTimeInfo.m_line = lineCol.first;
-  std::regex base_regex("`timescale([0-9]+)([mnsupf]+)/([0-9]+)([mnsupf]+)");
-  std::smatch base_match;
+  std::array<std::string_view, 4> fields;
   const std::string value = ctx->getText();
-  if (std::regex_match(value, base_match, base_regex)) {
-    std::ssub_match base1_sub_match = base_match[1];
-    std::string base1 = base1_sub_match.str();
+  if (splitTimescale(value, &fields)) {
+    const std::string base1(fields[0]);
     compUnitTimeInfo.m_timeUnitValue = std::stoi(base1);
     if ((compUnitTimeInfo.m_timeUnitValue != 1) &&
         (compUnitTimeInfo.m_timeUnitValue != 10) &&
         (compUnitTimeInfo.m_timeUnitValue != 100)) {
       logError(ErrorDefinition::PA_TIMESCALE_INVALID_VALUE, ctx, base1);
     }
-    compUnitTimeInfo.m_timeUnit = TimeInfo::unitFromString(base_match[2].str());
-    std::ssub_match base2_sub_match = base_match[3];
-    std::string base2 = base2_sub_match.str();
+    compUnitTimeInfo.m_timeUnit = TimeInfo::unitFromString(fields[1]);
+    const std::string base2(fields[2]);
     compUnitTimeInfo.m_timePrecisionValue = std::stoi(base2);
     if ((compUnitTimeInfo.m_timePrecisionValue != 1) &&
         (compUnitTimeInfo.m_timePrecisionValue != 10) &&
@@ -706,8 +728,7 @@ void SV3_1aTreeShapeListener::enterTimescale_directive(
     }
     uint64_t unitInFs = TimeInfo::femtoSeconds(
         compUnitTimeInfo.m_timeUnit, compUnitTimeInfo.m_timeUnitValue);
-    compUnitTimeInfo.m_timePrecision =
-        TimeInfo::unitFromString(base_match[4].str());
+    compUnitTimeInfo.m_timePrecision = TimeInfo::unitFromString(fields[3]);
     uint64_t precisionInFs =
         TimeInfo::femtoSeconds(compUnitTimeInfo.m_timePrecision,
                                compUnitTimeInfo.m_timePrecisionValue);
@@ -828,7 +849,7 @@ void SV3_1aTreeShapeListener::enterUdp_declaration(
                  VObjectType::paPRIMITIVE);
     }
   }
-  ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+  StringUtils::eraseAll(&ident, EscapeSequence);
   addDesignElement(ctx, ident, DesignElement::Primitive,
                    VObjectType::paPRIMITIVE);
 }
@@ -916,13 +937,7 @@ void SV3_1aTreeShapeListener::exitString_value(
 
   ident = ctx->String()->getText();
 
-  std::regex escaped(std::string(EscapeSequence) + std::string("(.*?)") +
-                     EscapeSequence);
-  std::smatch match;
-  while (std::regex_search(ident, match, escaped)) {
-    std::string var = "\\" + match[1].str() + " ";
-    ident = ident.replace(match.position(0), match.length(0), var);
-  }
+  StringUtils::replaceDelimited(&ident, EscapeSequence, "\\", " ");
 
   addVObject(ctx, ident, VObjectType::slStringLiteral);
 
@@ -1072,7 +1087,7 @@ void SV3_1aTreeShapeListener::exitHierarchical_identifier(
       if (symbol->getType() == SV3_1aParser::Simple_identifier ||
           symbol->getType() == SV3_1aParser::Escaped_identifier) {
         ident = tnode->getText();
-        ident = std::regex_replace(ident, std::regex(EscapeSequence), "");
+        StringUtils::eraseAll(&ident, EscapeSequence);
         addVObject((antlr4::ParserRuleContext *)tnode, ident,
                    VObjectType::slStringConst);
       } else if (symbol->getType() == SV3_1aParser::THIS ||
@@ -1279,13 +1294,7 @@ void SV3_1aTreeShapeListener::exitPackage_scope(
   } else if (ctx->Escaped_identifier()) {
     childCtx = (antlr4::ParserRuleContext *)ctx->Escaped_identifier();
     ident = ctx->Escaped_identifier()->getText();
-    std::regex escaped(std::string(EscapeSequence) + std::string("(.*?)") +
-                       EscapeSequence);
-    std::smatch match;
-    while (std::regex_search(ident, match, escaped)) {
-      std::string var = match[1].str();
-      ident = ident.replace(match.position(0), match.length(0), var);
-    }
+    StringUtils::replaceDelimited(&ident, EscapeSequence, "", "");
   } else if (ctx->THIS()) {
     childCtx = (antlr4::ParserRuleContext *)ctx->THIS();
     ident = ctx->THIS()->getText();
@@ -1320,13 +1329,7 @@ void SV3_1aTreeShapeListener::exitPs_identifier(
   } else if (!ctx->Escaped_identifier().empty()) {
     childCtx = (antlr4::ParserRuleContext *)ctx->Escaped_identifier()[0];
     ident = ctx->Escaped_identifier()[0]->getText();
-    std::regex escaped(std::string(EscapeSequence) + std::string("(.*?)") +
-                       EscapeSequence);
-    std::smatch match;
-    while (std::regex_search(ident, match, escaped)) {
-      std::string var = match[1].str();
-      ident = ident.replace(match.position(0), match.length(0), var);
-    }
+    StringUtils::replaceDelimited(&ident, EscapeSequence, "", "");
   } else if (!ctx->THIS().empty()) {
     childCtx = (antlr4::ParserRuleContext *)ctx->THIS()[0];
     ident = ctx->THIS()[0]->getText();
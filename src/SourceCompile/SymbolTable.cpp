@@ -0,0 +1,225 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/SourceCompile/SymbolTable.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace SURELOG {
+
+static constexpr size_t kArenaBlockSize = 64 * 1024;
+static constexpr std::string_view kEmptyMacroMarker = "@@EMPTY_MACRO@@";
+
+// Entries are laid out as [uint32_t length][text]['\0'].
+static std::string_view entryToView(const char* entry) {
+  uint32_t length = 0;
+  std::memcpy(&length, entry, sizeof(length));
+  return std::string_view(entry + sizeof(length), length);
+}
+
+static uint32_t shardIndex(std::string_view symbol, uint32_t shardCount) {
+  return std::hash<std::string_view>{}(symbol) & (shardCount - 1);
+}
+
+// Returns the bucket holding slot "index" and the position in that bucket.
+static std::pair<uint32_t, uint32_t> bucketPosition(uint64_t index,
+                                                    uint32_t firstBucketBits) {
+  const uint64_t position = index + (1ULL << firstBucketBits);
+  uint32_t highBit = 0;
+  while ((position >> (highBit + 1)) != 0) ++highBit;
+  return {highBit - firstBucketBits,
+          (uint32_t)(position - (1ULL << highBit))};
+}
+
+std::string_view SymbolTable::getEmptyMacroMarker() {
+  return kEmptyMacroMarker;
+}
+
+SymbolTable::SymbolTable() : m_idCounter(0) {
+  for (auto& bucket : m_buckets) bucket.store(nullptr);
+  registerSymbol(getBadSymbol());
+}
+
+SymbolTable::SymbolTable(const SymbolTable* parent)
+    : m_parent(parent),
+      m_idOffset(parent->m_idCounter.load(std::memory_order_acquire)),
+      m_idCounter(m_idOffset) {
+  for (auto& bucket : m_buckets) bucket.store(nullptr);
+}
+
+SymbolTable::~SymbolTable() {
+  for (auto& bucket : m_buckets) delete[] bucket.load();
+}
+
+std::atomic<const char*>& SymbolTable::allocateSlot(RawSymbolId id) {
+  const auto [bucketIndex, position] =
+      bucketPosition(id - m_idOffset, kFirstBucketBits);
+  std::atomic<std::atomic<const char*>*>& bucket = m_buckets[bucketIndex];
+  std::atomic<const char*>* slots = bucket.load(std::memory_order_acquire);
+  if (slots == nullptr) {
+    const size_t size = 1ULL << (bucketIndex + kFirstBucketBits);
+    std::atomic<const char*>* fresh = new std::atomic<const char*>[size];
+    for (size_t i = 0; i < size; ++i) {
+      fresh[i].store(nullptr, std::memory_order_relaxed);
+    }
+    if (bucket.compare_exchange_strong(slots, fresh,
+                                       std::memory_order_acq_rel)) {
+      slots = fresh;
+    } else {
+      // Another thread won the race, "slots" now holds its bucket.
+      delete[] fresh;
+    }
+  }
+  return slots[position];
+}
+
+const char* SymbolTable::getEntry(RawSymbolId id) const {
+  if (id >= m_idCounter.load(std::memory_order_acquire)) return nullptr;
+  const auto [bucketIndex, position] =
+      bucketPosition(id - m_idOffset, kFirstBucketBits);
+  const std::atomic<const char*>* slots =
+      m_buckets[bucketIndex].load(std::memory_order_acquire);
+  if (slots == nullptr) return nullptr;
+  return slots[position].load(std::memory_order_acquire);
+}
+
+SymbolId SymbolTable::getParentId(std::string_view symbol) const {
+  // Symbols added to the parent after the snapshot was taken are not visible.
+  const SymbolId id = m_parent->getId(symbol);
+  return ((RawSymbolId)id < m_idOffset) ? id : BadSymbolId;
+}
+
+std::pair<SymbolId, std::string_view> SymbolTable::add(
+    std::string_view symbol) {
+  if (m_parent != nullptr) {
+    if (symbol == getBadSymbol()) return {BadSymbolId, getBadSymbol()};
+    const SymbolId id = getParentId(symbol);
+    if ((RawSymbolId)id != BadRawSymbolId) {
+      return {id, m_parent->getSymbol(id)};
+    }
+  }
+
+  Shard& shard = m_shards[shardIndex(symbol, kShardCount)];
+  {
+    std::shared_lock<std::shared_mutex> lock(shard.m_mutex);
+    auto it = shard.m_symbol2IdMap.find(symbol);
+    if (it != shard.m_symbol2IdMap.end()) {
+      return {SymbolId(it->second, it->first), it->first};
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(shard.m_mutex);
+  auto it = shard.m_symbol2IdMap.find(symbol);
+  if (it != shard.m_symbol2IdMap.end()) {
+    return {SymbolId(it->second, it->first), it->first};
+  }
+
+  const uint32_t length = (uint32_t)symbol.length();
+  const size_t entrySize = sizeof(length) + length + 1;
+  if (entrySize > shard.m_available) {
+    const size_t blockSize = std::max(entrySize, kArenaBlockSize);
+    shard.m_blocks.emplace_back(new char[blockSize]);
+    shard.m_current = shard.m_blocks.back().get();
+    shard.m_available = blockSize;
+    shard.m_allocated += blockSize;
+  }
+  char* const entry = shard.m_current;
+  std::memcpy(entry, &length, sizeof(length));
+  std::memcpy(entry + sizeof(length), symbol.data(), length);
+  entry[sizeof(length) + length] = '\0';
+  shard.m_current += entrySize;
+  shard.m_available -= entrySize;
+
+  const RawSymbolId id = m_idCounter.fetch_add(1, std::memory_order_acq_rel);
+  allocateSlot(id).store(entry, std::memory_order_release);
+
+  const std::string_view text = entryToView(entry);
+  shard.m_symbol2IdMap.emplace(text, id);
+  return {SymbolId(id, text), text};
+}
+
+SymbolId SymbolTable::registerSymbol(std::string_view symbol) {
+  return add(symbol).first;
+}
+
+SymbolId SymbolTable::getId(std::string_view symbol) const {
+  if (m_parent != nullptr) {
+    const SymbolId id = getParentId(symbol);
+    if ((RawSymbolId)id != BadRawSymbolId) return id;
+  }
+
+  const Shard& shard = m_shards[shardIndex(symbol, kShardCount)];
+  std::shared_lock<std::shared_mutex> lock(shard.m_mutex);
+  auto it = shard.m_symbol2IdMap.find(symbol);
+  return (it == shard.m_symbol2IdMap.end()) ? BadSymbolId
+                                            : SymbolId(it->second, it->first);
+}
+
+std::string_view SymbolTable::getSymbol(SymbolId id) const {
+  const RawSymbolId rawId = (RawSymbolId)id;
+  if (rawId < m_idOffset) return m_parent->getSymbol(id);
+  const char* const entry = getEntry(rawId);
+  return (entry == nullptr) ? getBadSymbol() : entryToView(entry);
+}
+
+void SymbolTable::appendSymbols(RawSymbolId upTo,
+                                std::vector<std::string_view>* dest) const {
+  if (m_parent != nullptr) m_parent->appendSymbols(m_idOffset, dest);
+  for (RawSymbolId id = m_idOffset; id < upTo; ++id) {
+    // Slots of symbols still being registered by another thread are empty.
+    const char* const entry = getEntry(id);
+    dest->emplace_back((entry == nullptr) ? getBadSymbol()
+                                          : entryToView(entry));
+  }
+}
+
+std::vector<std::string_view> SymbolTable::getSymbols() const {
+  const RawSymbolId count = m_idCounter.load(std::memory_order_acquire);
+  std::vector<std::string_view> symbols;
+  symbols.reserve(count);
+  appendSymbols(count, &symbols);
+  return symbols;
+}
+
+size_t SymbolTable::getMemoryUsage() const {
+  size_t bytes = sizeof(SymbolTable);
+  for (const Shard& shard : m_shards) {
+    std::shared_lock<std::shared_mutex> lock(shard.m_mutex);
+    // Map nodes hold the key, the value and the hash chain link.
+    bytes += shard.m_allocated +
+             shard.m_symbol2IdMap.size() *
+                 (sizeof(std::string_view) + sizeof(RawSymbolId) +
+                  sizeof(void*)) +
+             shard.m_symbol2IdMap.bucket_count() * sizeof(void*);
+  }
+  for (uint32_t i = 0; i < kBucketCount; ++i) {
+    if (m_buckets[i].load(std::memory_order_acquire) != nullptr) {
+      bytes += (1ULL << (i + kFirstBucketBits)) *
+               sizeof(std::atomic<const char*>);
+    }
+  }
+  return bytes;
+}
+
+SymbolId SymbolTable::copyFrom(SymbolId id, const SymbolTable* source) {
+  if (source == this) return id;
+  return registerSymbol(source->getSymbol(id));
+}
+}  // namespace SURELOG
@@ -21,8 +21,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include "Surelog/Common/SymbolId.h"
@@ -188,5 +190,50 @@ TEST(SymbolTableTest, SequenceOfStackedSymbolTablesPreserved) {
       "@@BAD_SYMBOL@@", "foo", "bar", "baz", "quux", "foobar", "flip", "hello"};
   EXPECT_EQ(grandchild->getSymbols(), expected_grandchild);
 }
+
+TEST(SymbolTableTest, ConcurrentRegistrationSharesIds) {
+  SymbolTable table;
+  constexpr int32_t kThreadCount = 8;
+  constexpr size_t kSymbolCount = 10000;
+
+  // All threads register the same set of symbols, every symbol has to end up
+  // with a single id and a stable text.
+  std::vector<std::vector<SymbolId>> ids(kThreadCount);
+  std::vector<std::thread> threads;
+  for (int32_t t = 0; t < kThreadCount; ++t) {
+    threads.emplace_back([&table, &ids, t]() {
+      for (size_t i = 0; i < kSymbolCount; ++i) {
+        ids[t].emplace_back(table.registerSymbol("sym" + std::to_string(i)));
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  for (int32_t t = 1; t < kThreadCount; ++t) {
+    EXPECT_EQ(ids[t], ids[0]);
+  }
+  for (size_t i = 0; i < kSymbolCount; ++i) {
+    EXPECT_EQ(table.getSymbol(ids[0][i]), "sym" + std::to_string(i));
+  }
+
+  const std::vector<std::string_view> all_symbols = table.getSymbols();
+  EXPECT_EQ(all_symbols.size(), kSymbolCount + 1);
+  for (size_t i = 0; i < all_symbols.size(); ++i) {
+    EXPECT_EQ(table.getId(all_symbols[i]), SymbolId(i, all_symbols[i]));
+  }
+}
+
+TEST(SymbolTableTest, MemoryUsageGrowsWithSymbols) {
+  SymbolTable table;
+  const size_t initial = table.getMemoryUsage();
+  for (int32_t i = 0; i < 1000; ++i) {
+    table.registerSymbol("sym" + std::to_string(i));
+  }
+  EXPECT_GT(table.getMemoryUsage(), initial);
+
+  // Snapshots only account for what they own.
+  std::unique_ptr<SymbolTable> snapshot(table.CreateSnapshot());
+  EXPECT_LT(snapshot->getMemoryUsage(), table.getMemoryUsage());
+}
 }  // namespace
 }  // namespace SURELOG
@@ -0,0 +1,74 @@
+/*
+ Copyright 2022 chipsalliance
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ */
+
+#include "Surelog/Utils/MemoryUtils.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include "Surelog/Utils/StringUtils.h"
+
+#if !(defined(_MSC_VER) || defined(__MINGW32__) || defined(__CYGWIN__))
+#include <sys/resource.h>
+#endif
+
+namespace SURELOG::MemoryUtils {
+
+#if defined(__linux__)
+// Reads a "<key>: <value> kB" entry of /proc/self/status.
+static uint64_t readProcStatus(std::string_view key) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, key.length(), key) == 0) {
+      return std::stoull(line.substr(key.length())) * 1024;
+    }
+  }
+  return 0;
+}
+#endif
+
+uint64_t getResidentBytes() {
+#if defined(__linux__)
+  return readProcStatus("VmRSS:");
+#else
+  return 0;
+#endif
+}
+
+uint64_t getPeakResidentBytes() {
+#if defined(__linux__)
+  return readProcStatus("VmHWM:");
+#elif defined(_MSC_VER) || defined(__MINGW32__) || defined(__CYGWIN__)
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss;  // Already in bytes
+#else
+  return (uint64_t)usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+std::string toMegaBytes(uint64_t bytes) {
+  return StringUtils::to_string(bytes / (1024.0 * 1024.0), 1) + "MB";
+}
+
+}  // namespace SURELOG::MemoryUtils
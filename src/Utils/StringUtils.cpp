@@ -258,6 +258,45 @@ std::string StringUtils::replaceAll(std::string_view str, std::string_view from,
   return result;
 }
 
+void StringUtils::eraseAll(std::string* str, std::string_view what) {
+  if (what.empty()) return;
+  size_t to = str->find(what);
+  size_t from = to;
+  if (from == std::string::npos) return;
+  // Compact the kept characters towards the front, no reallocation.
+  while (from != std::string::npos) {
+    from += what.length();
+    const size_t next = str->find(what, from);
+    const size_t end = (next == std::string::npos) ? str->length() : next;
+    std::copy(str->begin() + from, str->begin() + end, str->begin() + to);
+    to += end - from;
+    from = next;
+  }
+  str->resize(to);
+}
+
+void StringUtils::replaceDelimited(std::string* str,
+                                   std::string_view delimiter,
+                                   std::string_view prefix,
+                                   std::string_view suffix) {
+  if (delimiter.empty()) return;
+  size_t open = 0;
+  while ((open = str->find(delimiter, open)) != std::string::npos) {
+    const size_t body = open + delimiter.length();
+    const size_t close = str->find(delimiter, body);
+    if (close == std::string::npos) return;
+    if (str->find('\n', body) < close) {
+      // Not a pair, the closing delimiter may open the next one.
+      open = close;
+      continue;
+    }
+    str->replace(close, delimiter.length(), suffix);
+    str->replace(open, delimiter.length(), prefix);
+    // The prefix may complete a delimiter with the text before it.
+    open = (open + 1 > delimiter.length()) ? open + 1 - delimiter.length() : 0;
+  }
+}
+
 // Split off the next view split with "separator" character.
 // Modifies "src" to contain the remaining string.
 // If "src" is exhausted, returned string-view will have data() == nullptr.
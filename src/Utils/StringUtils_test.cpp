@@ -221,6 +221,41 @@ TEST(StringUtilsTest, ReplaceAll) {
   EXPECT_EQ("", StringUtils::replaceAll("A", "A", ""));
 }
 
+TEST(StringUtilsTest, EraseAll) {
+  std::string str = "#~@foo#~@.bar#~@";
+  StringUtils::eraseAll(&str, "#~@");
+  EXPECT_EQ("foo.bar", str);
+
+  str = "aaa";
+  StringUtils::eraseAll(&str, "aa");
+  EXPECT_EQ("a", str);
+
+  str = "untouched";
+  StringUtils::eraseAll(&str, "#~@");
+  EXPECT_EQ("untouched", str);
+  StringUtils::eraseAll(&str, "");
+  EXPECT_EQ("untouched", str);
+}
+
+TEST(StringUtilsTest, ReplaceDelimited) {
+  std::string str = "x #~@a.b#~@ y #~@c#~@";
+  StringUtils::replaceDelimited(&str, "#~@", "\\", " ");
+  EXPECT_EQ("x \\a.b  y \\c ", str);
+
+  str = "#~@a\n#~@b#~@";
+  StringUtils::replaceDelimited(&str, "#~@", "", "");
+  EXPECT_EQ("#~@a\nb", str);
+
+  str = "#~@unterminated";
+  StringUtils::replaceDelimited(&str, "#~@", "", "");
+  EXPECT_EQ("#~@unterminated", str);
+
+  // Like a search restarted from the beginning after each replacement.
+  str = "##~@~@#~@x";
+  StringUtils::replaceDelimited(&str, "#~@", "", "");
+  EXPECT_EQ("#~@x", str);
+}
+
 TEST(StringUtilsTest, GetLineInString) {
   {
     constexpr std::string_view input_text = "one\ntwo\nthree\nno-newline";